@@ -6,9 +6,30 @@
  * @version 3.0
  * @date 10/2011
  */
+#include <limits.h>
 #include <stdlib.h>
 #include "array.h"
 
+/**
+ * Number of bits of each word of an occupancy bitmap.
+ */
+#define WBITS ((int)(CHAR_BIT*sizeof(unsigned long)))
+
+/**
+ * Given a capacity (<tt>N</tt>), provides the number of words of the
+ * occupancy bitmap.
+ */
+#define WORDS(N) (((N)+WBITS-1)/WBITS)
+
+/**
+ * Given an array (<tt>A</tt>) and a position (<tt>I</tt>), updates the bit of
+ * the position in the occupancy bitmap, according to whether the position is
+ * filled.
+ */
+#define MARK(A,I) \
+  ((A)->array[I]?((A)->used[(I)/WBITS]|=1UL<<((I)%WBITS)) \
+                :((A)->used[(I)/WBITS]&=~(1UL<<((I)%WBITS))))
+
 Array newArray(int size)
 {
   Array array=NULL;
@@ -20,8 +41,11 @@ Array newArray(int size)
       array->capacity=size;
       array->size=0;
       array->array=calloc(size,sizeof(void*));
-      if(!array->array)
+      array->used=calloc(WORDS(size),sizeof(unsigned long));
+      if(!array->array||!array->used)
       {
+        free(array->array);
+        free(array->used);
         free(array);
 	array=NULL;
       }
@@ -35,6 +59,7 @@ Array newArray(int size)
 void arrayDelete(Array array)
 {
   free(array->array);
+  free(array->used);
   free(array);
 }
 
@@ -51,17 +76,23 @@ int arrayInsert(Array array,int index,void* elem,int replace)
     {
       array->size++;
       array->array[index]=elem;
+      MARK(array,index);
     }
   }
   else if(array->array[index])
   {
-    if(replace) array->array[index]=elem;
+    if(replace)
+    {
+      array->array[index]=elem;
+      MARK(array,index);
+    }
     result=1;
   }
   else 
   {
     array->size++;
     array->array[index]=elem;
+    MARK(array,index);
   }
   return result;
 }
@@ -85,6 +116,7 @@ int arrayRemove(Array array,int index,void** elem)
   {
     if(elem) *elem=array->array[index];
     array->array[index]=NULL;
+    MARK(array,index);
     array->size--;
   }
   return result;
@@ -111,10 +143,50 @@ int arrayAt(Array array,int index,void** elem)
 
 //==============================================================================
 
+/**
+ * Provides the number of trailing zero bits of a non zero word.
+ *
+ * @param word the word
+ *
+ * @return
+ * the number of trailing zero bits
+ */
+static int arrayCtz(unsigned long word)
+{
+#ifdef __GNUC__
+  return __builtin_ctzl(word);
+#else
+  int result=0;
+  for(;!(word&1UL);word>>=1) result++;
+  return result;
+#endif
+}
+
+//==============================================================================
+
+int arrayNext(Array array,int index)
+{
+  int w,words,result=-1;
+  unsigned long bits=0;
+  index=index<0?0:index+1;
+  if(index<array->capacity)
+  {
+    words=WORDS(array->capacity);
+    w=index/WBITS;
+    bits=array->used[w]&(~0UL<<(index%WBITS));
+    while(!bits&&++w<words) bits=array->used[w];
+    if(bits) result=w*WBITS+arrayCtz(bits);
+  }
+  return result;
+}
+
+//==============================================================================
+
 int arrayResize(Array array,int size)
 {
   int i,result=0;
   void** newarray;
+  unsigned long* newused;
   if(array->capacity>=size) result=2;
   else
   {
@@ -124,7 +196,14 @@ int arrayResize(Array array,int size)
     {
       for(i=array->capacity;i<size;i++) newarray[i]=NULL;
       array->array=newarray;
-      array->capacity=size;
+      newused=realloc(array->used,WORDS(size)*sizeof(unsigned long));
+      if(!newused) result=1;
+      else
+      {
+        for(i=WORDS(array->capacity);i<WORDS(size);i++) newused[i]=0;
+        array->used=newused;
+        array->capacity=size;
+      }
     }
   }
   return result;
@@ -148,18 +227,12 @@ int arrayCapacity(Array array)
 
 int arrayMap(Array array,void(*fun)(void*))
 {
-  int i,j,result=0;
+  int i,result=0;
   if(!array->size) result=1;
   else
   {
-    for(i=0,j=0;i<array->capacity&&j<array->size;i++)
-    {
-      if(array->array[i])
-      {
-        fun(array->array[i]);
-        j++;
-      }
-    }
+    for(i=arrayNext(array,-1);i>=0;i=arrayNext(array,i))
+      fun(array->array[i]);
   }
   return result;
 }
@@ -168,17 +241,11 @@ int arrayMap(Array array,void(*fun)(void*))
 
 Iterator arrayIterator(Array array)
 {
-  int ctrl,i,j;
+  int ctrl,i;
   Iterator it;
   it=newIt(array->size);
-  for(ctrl=0,i=0,j=0;i<array->capacity&&j<array->size&&!ctrl;i++)
-  {
-    if(array->array[i])
-    {
-      ctrl=itAdd(it,array->array[i]);
-      j++;
-    }
-  }
+  for(ctrl=0,i=arrayNext(array,-1);i>=0&&!ctrl;i=arrayNext(array,i))
+    ctrl=itAdd(it,array->array[i]);
   if(ctrl)
   {
     itDelete(it);
@@ -186,3 +253,38 @@ Iterator arrayIterator(Array array)
   }
   return it;
 }
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator over an array.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int arrayLazyNext(LazyIt it,void** val)
+{
+  int result=0;
+  Array array=it->state[0];
+  it->index[0]=arrayNext(array,it->index[0]-1);
+  if(it->index[0]<0)
+  {
+    it->index[0]=array->capacity;
+    result=1;
+  }
+  else *val=array->array[it->index[0]++];
+  return result;
+}
+
+//==============================================================================
+
+LazyIt arrayLazy(Array array)
+{
+  LazyIt it=newLazy(arrayLazyNext,NULL);
+  if(it) it->state[0]=array;
+  return it;
+}
@@ -16,6 +16,7 @@
 #define _ARRAY_H_
 
 #include "iterator.h"
+#include "lazyit.h"
 
 /**
  * Array structure.
@@ -28,6 +29,8 @@ typedef struct sArray
   int size;
   ///Array of pointers to this array's elements.
   void** array;
+  ///Occupancy bitmap of this array (one bit for each position).
+  unsigned long* used;
 }SArray;
 
 /**
@@ -129,6 +132,22 @@ int arrayRemove(Array array,int index,void** elem);
  */
 int arrayAt(Array array,int index,void** elem);
 
+/**
+ * Provides the first filled position of an array after the specified one.
+ *
+ * Uses the occupancy bitmap of the array, so that empty positions are skipped
+ * a word at a time.  The first filled position of the array is given by
+ * <tt>arrayNext(array,-1)</tt>.
+ *
+ * @param array the array
+ * @param index the index after which the search starts
+ *
+ * @return
+ * -1 if there is no filled position after <tt>index</tt>\n
+ * the first filled position after <tt>index</tt> otherwise
+ */
+int arrayNext(Array array,int index);
+
 /**
  * Increases the capacity of an array.
  *
@@ -191,4 +210,17 @@ int arrayMap(Array array,void(*fun)(void*));
  */
 Iterator arrayIterator(Array array);
 
+/**
+ * Creates a lazy iterator from an array.
+ *
+ * @see LazyIt
+ *
+ * @param array the array
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt arrayLazy(Array array);
+
 #endif
@@ -0,0 +1,278 @@
+/**
+ * Implementation of a blocking queue.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file bqueue.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <stdlib.h>
+#include <time.h>
+#include "bqueue.h"
+
+/**
+ * Given a blocking queue (<tt>Q</tt>), tells whether it is full.
+ */
+#define FULL(Q) ((Q)->capacity&&queueSize((Q)->queue)>=(Q)->capacity)
+
+BQueue newBQueue(int capacity)
+{
+  int error=0;
+  BQueue queue=NULL;
+  if(capacity>=0)
+  {
+    queue=malloc(sizeof(SBQueue));
+    if(queue)
+    {
+      queue->queue=newQueue();
+      if(!queue->queue) error=1;
+      else if(pthread_mutex_init(&queue->lock,NULL)) error=2;
+      else if(pthread_cond_init(&queue->notEmpty,NULL)) error=3;
+      else if(pthread_cond_init(&queue->notFull,NULL)) error=4;
+      if(error)
+      {
+        if(error>3) pthread_cond_destroy(&queue->notEmpty);
+        if(error>2) pthread_mutex_destroy(&queue->lock);
+        if(error>1) queueDelete(queue->queue);
+        free(queue);
+        queue=NULL;
+      }
+      else
+      {
+        queue->capacity=capacity;
+        queue->takers=0;
+        queue->putters=0;
+      }
+    }
+  }
+  return queue;
+}
+
+//==============================================================================
+
+void bqueueDelete(BQueue queue)
+{
+  pthread_cond_destroy(&queue->notFull);
+  pthread_cond_destroy(&queue->notEmpty);
+  pthread_mutex_destroy(&queue->lock);
+  queueDelete(queue->queue);
+  free(queue);
+}
+
+//==============================================================================
+
+/**
+ * Computes the absolute time at which a timeout expires.
+ *
+ * Negative timeouts are taken as 0, and deadlines that cannot be represented
+ * are limited to the largest time that can be represented on every platform.
+ *
+ * @param timeout  the timeout (in milliseconds)
+ * @param deadline where the absolute time will be put
+ */
+static void bqueueDeadline(long timeout,struct timespec* deadline)
+{
+  long sec;
+  if(timeout<0) timeout=0;
+  sec=timeout/1000;
+  clock_gettime(CLOCK_REALTIME,deadline);
+  if(sizeof(time_t)<8&&sec>INT_MAX-1-(long)deadline->tv_sec)
+    sec=INT_MAX-1-(long)deadline->tv_sec;
+  deadline->tv_sec+=sec;
+  deadline->tv_nsec+=(timeout%1000)*1000000L;
+  if(deadline->tv_nsec>=1000000000L)
+  {
+    deadline->tv_sec++;
+    deadline->tv_nsec-=1000000000L;
+  }
+  else if(deadline->tv_nsec<0)
+  {
+    deadline->tv_sec--;
+    deadline->tv_nsec+=1000000000L;
+  }
+}
+
+//==============================================================================
+
+/**
+ * Waits on a condition of a blocking queue, while recording that the thread
+ * is waiting.
+ *
+ * The lock of the queue must be held.
+ *
+ * @param queue    the queue
+ * @param cond     the condition
+ * @param waiters  the number of threads waiting on the condition
+ * @param deadline the time at which the wait expires (or <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the thread was woken\n
+ * 1 if the time expired (or the timed wait failed)
+ */
+static int bqueueWait(BQueue queue,pthread_cond_t* cond,int* waiters,
+    const struct timespec* deadline)
+{
+  int rc;
+  (*waiters)++;
+  if(deadline) rc=pthread_cond_timedwait(cond,&queue->lock,deadline);
+  else rc=pthread_cond_wait(cond,&queue->lock);
+  (*waiters)--;
+  return deadline&&rc;
+}
+
+//==============================================================================
+
+/**
+ * Wakes the threads waiting on a condition of a blocking queue, after
+ * <tt>n</tt> elements were inserted or removed.
+ *
+ * The lock of the queue must be held.
+ *
+ * @param cond    the condition
+ * @param waiters the number of threads waiting on the condition
+ * @param n       the number of elements inserted or removed
+ */
+static void bqueueWake(pthread_cond_t* cond,int waiters,int n)
+{
+  if(waiters&&n==1) pthread_cond_signal(cond);
+  else if(waiters&&n>1) pthread_cond_broadcast(cond);
+}
+
+//==============================================================================
+
+/**
+ * Inserts an element in a blocking queue, waiting while the queue is full.
+ *
+ * @param queue    the queue
+ * @param value    the value to be inserted
+ * @param deadline the time at which the wait expires (or <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if the time expired while the queue was full\n
+ * 2 if it was not possible to insert the new element
+ */
+static int bqueuePutAux(BQueue queue,void* value,
+    const struct timespec* deadline)
+{
+  int expired=0,result=0;
+  pthread_mutex_lock(&queue->lock);
+  while(FULL(queue)&&!expired)
+    expired=bqueueWait(queue,&queue->notFull,&queue->putters,deadline);
+  if(FULL(queue)) result=1;
+  else if(queueInsert(queue->queue,value)) result=2;
+  else bqueueWake(&queue->notEmpty,queue->takers,1);
+  pthread_mutex_unlock(&queue->lock);
+  return result;
+}
+
+//==============================================================================
+
+int bqueuePut(BQueue queue,void* value)
+{
+  return bqueuePutAux(queue,value,NULL);
+}
+
+//==============================================================================
+
+int bqueueTimedPut(BQueue queue,void* value,long timeout)
+{
+  struct timespec deadline;
+  bqueueDeadline(timeout,&deadline);
+  return bqueuePutAux(queue,value,&deadline);
+}
+
+//==============================================================================
+
+int bqueuePutBatch(BQueue queue,void** values,int n)
+{
+  int i,error=0,pending=0;
+  pthread_mutex_lock(&queue->lock);
+  for(i=0;i<n&&!error;)
+  {
+    if(FULL(queue))
+    {
+      bqueueWake(&queue->notEmpty,queue->takers,pending);
+      pending=0;
+      bqueueWait(queue,&queue->notFull,&queue->putters,NULL);
+    }
+    else if(queueInsert(queue->queue,values[i])) error=1;
+    else
+    {
+      pending++;
+      i++;
+    }
+  }
+  bqueueWake(&queue->notEmpty,queue->takers,pending);
+  pthread_mutex_unlock(&queue->lock);
+  return i;
+}
+
+//==============================================================================
+
+/**
+ * Removes an element from a blocking queue, waiting while the queue is empty.
+ *
+ * @param queue    the queue
+ * @param value    pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ * @param deadline the time at which the wait expires (or <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 if the time expired while the queue was empty
+ */
+static int bqueueTakeAux(BQueue queue,void** value,
+    const struct timespec* deadline)
+{
+  int expired=0,result;
+  pthread_mutex_lock(&queue->lock);
+  while(!queueSize(queue->queue)&&!expired)
+    expired=bqueueWait(queue,&queue->notEmpty,&queue->takers,deadline);
+  result=queueRemove(queue->queue,value);
+  if(!result) bqueueWake(&queue->notFull,queue->putters,1);
+  pthread_mutex_unlock(&queue->lock);
+  return result;
+}
+
+//==============================================================================
+
+int bqueueTake(BQueue queue,void** value)
+{
+  return bqueueTakeAux(queue,value,NULL);
+}
+
+//==============================================================================
+
+int bqueueTimedTake(BQueue queue,void** value,long timeout)
+{
+  struct timespec deadline;
+  bqueueDeadline(timeout,&deadline);
+  return bqueueTakeAux(queue,value,&deadline);
+}
+
+//==============================================================================
+
+int bqueueDrain(BQueue queue,void** values,int max)
+{
+  int n;
+  pthread_mutex_lock(&queue->lock);
+  for(n=0;n<max&&!queueRemove(queue->queue,values+n);n++);
+  bqueueWake(&queue->notFull,queue->putters,n);
+  pthread_mutex_unlock(&queue->lock);
+  return n;
+}
+
+//==============================================================================
+
+int bqueueSize(BQueue queue)
+{
+  int size;
+  pthread_mutex_lock(&queue->lock);
+  size=queueSize(queue->queue);
+  pthread_mutex_unlock(&queue->lock);
+  return size;
+}
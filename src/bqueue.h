@@ -0,0 +1,174 @@
+/**
+ * Implementation of a blocking queue.
+ *
+ * Provides functions to create and manipulate a queue that can be shared by
+ * several threads, where consumers wait until there are elements to remove and,
+ * if the queue is bounded, producers wait until there is room for new
+ * elements.  Waits can be limited by a timeout.
+ *
+ * The elements are stored in a <tt>@ref Queue</tt> protected by a POSIX mutex,
+ * and waiting threads are woken using condition variables.  Threads are only
+ * signalled when there are threads waiting, and inserting (or removing) a batch
+ * of elements wakes the waiting threads once, instead of once per element.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file bqueue.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _BQUEUE_H_
+#define _BQUEUE_H_
+
+#include <pthread.h>
+#include "queue.h"
+
+/**
+ * Blocking queue structure.
+ */
+typedef struct sBQueue
+{
+  ///Elements of this queue.
+  Queue queue;
+  ///Maximum number of elements of this queue (0 if unbounded).
+  int capacity;
+  ///Number of threads waiting for elements.
+  int takers;
+  ///Number of threads waiting for room.
+  int putters;
+  ///Lock that protects this queue.
+  pthread_mutex_t lock;
+  ///Condition signalled when elements are inserted.
+  pthread_cond_t notEmpty;
+  ///Condition signalled when elements are removed.
+  pthread_cond_t notFull;
+}SBQueue;
+
+/**
+ * Blocking queue definition.
+ */
+typedef SBQueue* BQueue;
+
+//==============================================================================
+
+/**
+ * Creates a blocking queue.
+ *
+ * @param capacity the maximum number of elements of the queue (or 0, for an
+ * unbounded queue)
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new queue otherwise
+ */
+BQueue newBQueue(int capacity);
+
+/**
+ * Deletes a blocking queue.
+ *
+ * @attention
+ * This function only frees the memory used by the queue.  It does not free the
+ * memory used by elements the queue contains.  No thread may be using the
+ * queue.
+ *
+ * @param queue the queue to be deleted
+ */
+void bqueueDelete(BQueue queue);
+
+/**
+ * Inserts an element in a blocking queue, waiting while the queue is full.
+ *
+ * @param queue the queue
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 2 if it was not possible to insert the new element
+ */
+int bqueuePut(BQueue queue,void* value);
+
+/**
+ * Inserts an element in a blocking queue, waiting at most the specified time
+ * while the queue is full.
+ *
+ * @param queue   the queue
+ * @param value   the value to be inserted
+ * @param timeout the maximum time to wait (in milliseconds; a negative value is
+ * taken as 0, so the function does not wait)
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if the time expired while the queue was full\n
+ * 2 if it was not possible to insert the new element
+ */
+int bqueueTimedPut(BQueue queue,void* value,long timeout);
+
+/**
+ * Inserts several elements in a blocking queue, waiting while the queue is
+ * full.
+ *
+ * The waiting consumers are woken once for the whole batch.
+ *
+ * @param queue  the queue
+ * @param values the values to be inserted
+ * @param n      the number of values
+ *
+ * @return
+ * the number of values inserted (less than <tt>n</tt> only if it was not
+ * possible to insert an element)
+ */
+int bqueuePutBatch(BQueue queue,void** values,int n);
+
+/**
+ * Removes an element from a blocking queue, waiting while the queue is empty.
+ *
+ * @param queue the queue
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed
+ */
+int bqueueTake(BQueue queue,void** value);
+
+/**
+ * Removes an element from a blocking queue, waiting at most the specified time
+ * while the queue is empty.
+ *
+ * @param queue   the queue
+ * @param value   pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ * @param timeout the maximum time to wait (in milliseconds; a negative value is
+ * taken as 0, so the function does not wait)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 if the time expired while the queue was empty
+ */
+int bqueueTimedTake(BQueue queue,void** value,long timeout);
+
+/**
+ * Removes up to the specified number of elements from a blocking queue,
+ * without waiting.
+ *
+ * The waiting producers are woken once for the whole batch.
+ *
+ * @param queue  the queue
+ * @param values array where the removed values will be put
+ * @param max    the maximum number of values to be removed
+ *
+ * @return
+ * the number of values removed
+ */
+int bqueueDrain(BQueue queue,void** values,int max);
+
+/**
+ * Returns the size of a blocking queue.
+ *
+ * @param queue the queue
+ *
+ * @return
+ * the size of the queue
+ */
+int bqueueSize(BQueue queue);
+
+#endif
@@ -0,0 +1,525 @@
+/**
+ * Implementation of a compact AVL tree (self-balancing binary search tree).
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ctreemap.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "ctreemap.h"
+
+/**
+ * Initial capacity of a compact tree.
+ */
+#define CAPACITY 16
+
+/**
+ * Given a tree (<tt>T</tt>) and a node index (<tt>I</tt>), provides the node.
+ */
+#define NODE(T,I) ((T)->nodes[I])
+
+/**
+ * Given a tree (<tt>T</tt>) and a node index (<tt>I</tt>), provides the index
+ * of the parent node.
+ */
+#define SUPER(T,I) (NODE(T,I).super&CTREE_MAX)
+
+/**
+ * Given a tree (<tt>T</tt>) and a node index (<tt>I</tt>), provides the
+ * balance factor of the node (-1, 0, or 1, for <tt>L</tt>, <tt>E</tt>, and
+ * <tt>R</tt>, respectively).
+ */
+#define BF(T,I) ((int)(NODE(T,I).super>>30)-1)
+
+//==============================================================================
+
+/**
+ * Sets the parent of a node, preserving its balance factor.
+ *
+ * @param tree  the tree
+ * @param node  the node index
+ * @param super the parent index
+ */
+static void ctreeSetSuper(CTreeMap tree,uint32_t node,uint32_t super)
+{
+  NODE(tree,node).super=(NODE(tree,node).super&~CTREE_MAX)|super;
+}
+
+//==============================================================================
+
+/**
+ * Sets the balance factor of a node, preserving its parent.
+ *
+ * @param tree the tree
+ * @param node the node index
+ * @param bf   the balance factor (-1, 0, or 1)
+ */
+static void ctreeSetBF(CTreeMap tree,uint32_t node,int bf)
+{
+  NODE(tree,node).super=SUPER(tree,node)|((uint32_t)(bf+1)<<30);
+}
+
+//==============================================================================
+
+/**
+ * Replaces a child of a node (or the root of a tree, if the node index is 0).
+ *
+ * @param tree  the tree
+ * @param super the parent index
+ * @param old   the old child index
+ * @param new   the new child index
+ */
+static void ctreeRelink(CTreeMap tree,uint32_t super,uint32_t old,uint32_t new)
+{
+  if(!super) tree->root=new;
+  else if(NODE(tree,super).left==old) NODE(tree,super).left=new;
+  else NODE(tree,super).right=new;
+}
+
+//==============================================================================
+
+/**
+ * Rotates a subtree to left.
+ *
+ * @param tree the tree
+ * @param node the root index of the subtree to rotate
+ *
+ * @return
+ * the new root index of the subtree
+ */
+static uint32_t ctreeLeftRotate(CTreeMap tree,uint32_t node)
+{
+  uint32_t aux=NODE(tree,node).right,super=SUPER(tree,node);
+  NODE(tree,node).right=NODE(tree,aux).left;
+  if(NODE(tree,node).right) ctreeSetSuper(tree,NODE(tree,node).right,node);
+  NODE(tree,aux).left=node;
+  ctreeSetSuper(tree,node,aux);
+  ctreeSetSuper(tree,aux,super);
+  ctreeRelink(tree,super,node,aux);
+  return aux;
+}
+
+//==============================================================================
+
+/**
+ * Rotates a subtree to right.
+ *
+ * @param tree the tree
+ * @param node the root index of the subtree to rotate
+ *
+ * @return
+ * the new root index of the subtree
+ */
+static uint32_t ctreeRightRotate(CTreeMap tree,uint32_t node)
+{
+  uint32_t aux=NODE(tree,node).left,super=SUPER(tree,node);
+  NODE(tree,node).left=NODE(tree,aux).right;
+  if(NODE(tree,node).left) ctreeSetSuper(tree,NODE(tree,node).left,node);
+  NODE(tree,aux).right=node;
+  ctreeSetSuper(tree,node,aux);
+  ctreeSetSuper(tree,aux,super);
+  ctreeRelink(tree,super,node,aux);
+  return aux;
+}
+
+//==============================================================================
+
+/**
+ * Rebalances a subtree whose balance factor is -2 or 2, and updates the balance
+ * factors of the rotated nodes.
+ *
+ * @param tree the tree
+ * @param node the root index of the subtree
+ * @param bf   the balance factor of the subtree
+ *
+ * @return
+ * the new root index of the subtree
+ */
+static uint32_t ctreeBalance(CTreeMap tree,uint32_t node,int bf)
+{
+  uint32_t child,aux;
+  int bc,ba;
+  child=bf>0?NODE(tree,node).right:NODE(tree,node).left;
+  bc=BF(tree,child);
+  if(bf>0&&bc>=0)
+  {
+    aux=ctreeLeftRotate(tree,node);
+    ctreeSetBF(tree,node,bc?0:1);
+    ctreeSetBF(tree,child,bc?0:-1);
+  }
+  else if(bf<0&&bc<=0)
+  {
+    aux=ctreeRightRotate(tree,node);
+    ctreeSetBF(tree,node,bc?0:-1);
+    ctreeSetBF(tree,child,bc?0:1);
+  }
+  else
+  {
+    aux=bf>0?NODE(tree,child).left:NODE(tree,child).right;
+    ba=BF(tree,aux);
+    if(bf>0)
+    {
+      ctreeRightRotate(tree,child);
+      ctreeLeftRotate(tree,node);
+    }
+    else
+    {
+      ctreeLeftRotate(tree,child);
+      ctreeRightRotate(tree,node);
+    }
+    ctreeSetBF(tree,node,ba==bf/2?-ba:0);
+    ctreeSetBF(tree,child,ba==-bf/2?-ba:0);
+    ctreeSetBF(tree,aux,0);
+  }
+  return aux;
+}
+
+//==============================================================================
+
+CTreeMap newCTree(int(*keyComp)(void*,void*))
+{
+  CTreeMap tree=NULL;
+  if(keyComp)
+  {
+    tree=malloc(sizeof(SCTreeMap));
+    if(tree)
+    {
+      tree->keyComp=*keyComp;
+      tree->size=0;
+      tree->capacity=CAPACITY;
+      tree->root=0;
+      tree->nodes=malloc((CAPACITY+1)*sizeof(SCTreeNode));
+      if(!tree->nodes)
+      {
+        free(tree);
+        tree=NULL;
+      }
+    }
+  }
+  return tree;
+}
+
+//==============================================================================
+
+CTreeMap ctreeClone(CTreeMap tree)
+{
+  CTreeMap new=malloc(sizeof(SCTreeMap));
+  if(new)
+  {
+    *new=*tree;
+    new->nodes=malloc((tree->capacity+1)*sizeof(SCTreeNode));
+    if(!new->nodes)
+    {
+      free(new);
+      new=NULL;
+    }
+    else memcpy(new->nodes,tree->nodes,(tree->size+1)*sizeof(SCTreeNode));
+  }
+  return new;
+}
+
+//==============================================================================
+
+int ctreeSetKComp(CTreeMap tree,int(*keyComp)(void*,void*))
+{
+  int result=0;
+  if(!keyComp) result=1;
+  else tree->keyComp=*keyComp;
+  return result;
+}
+
+//==============================================================================
+
+void ctreeDelete(CTreeMap tree)
+{
+  free(tree->nodes);
+  free(tree);
+}
+
+//==============================================================================
+
+int ctreeInsert(CTreeMap tree,void* key,void* value,int replace)
+{
+  int sig=0,bf,stop,capacity,result=0;
+  uint32_t aux,super,new;
+  SCTreeNode* nodes;
+  for(super=0,aux=tree->root;aux&&(sig=tree->keyComp(key,NODE(tree,aux).key));
+      super=aux,aux=sig<0?NODE(tree,aux).left:NODE(tree,aux).right);
+  if(aux)
+  {
+    if(replace) NODE(tree,aux).value=value;
+    result=1;
+  }
+  else if(tree->size==CTREE_MAX) result=2;
+  else
+  {
+    if(tree->size==tree->capacity)
+    {
+      capacity=tree->capacity>CTREE_MAX/2?CTREE_MAX:2*tree->capacity;
+      nodes=realloc(tree->nodes,(capacity+1)*sizeof(SCTreeNode));
+      if(!nodes) result=2;
+      else
+      {
+        tree->nodes=nodes;
+        tree->capacity=capacity;
+      }
+    }
+    if(!result)
+    {
+      new=++tree->size;
+      NODE(tree,new).key=key;
+      NODE(tree,new).value=value;
+      NODE(tree,new).super=super;
+      NODE(tree,new).left=0;
+      NODE(tree,new).right=0;
+      ctreeSetBF(tree,new,0);
+      if(!super) tree->root=new;
+      else if(sig<0) NODE(tree,super).left=new;
+      else NODE(tree,super).right=new;
+      for(aux=new,stop=0;!stop&&super;aux=super,super=SUPER(tree,aux))
+      {
+        bf=BF(tree,super)+(aux==NODE(tree,super).left?-1:1);
+        if(bf==-2||bf==2)
+        {
+          ctreeBalance(tree,super,bf);
+          stop=1;
+        }
+        else
+        {
+          ctreeSetBF(tree,super,bf);
+          stop=!bf;
+        }
+      }
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Removes a node with at most one child from a tree, rebalances the tree, and
+ * moves the last node of the array to the free position.
+ *
+ * @param tree the tree
+ * @param node the index of the node to be removed
+ */
+static void ctreeUnlink(CTreeMap tree,uint32_t node)
+{
+  int bf,stop,dir;
+  uint32_t child,super,last;
+  child=NODE(tree,node).left?NODE(tree,node).left:NODE(tree,node).right;
+  super=SUPER(tree,node);
+  dir=super&&NODE(tree,super).left==node?1:-1;
+  ctreeRelink(tree,super,node,child);
+  if(child) ctreeSetSuper(tree,child,super);
+  for(stop=0;!stop&&super;)
+  {
+    bf=BF(tree,super)+dir;
+    if(bf==-2||bf==2)
+    {
+      super=ctreeBalance(tree,super,bf);
+      stop=BF(tree,super)!=0;
+    }
+    else
+    {
+      ctreeSetBF(tree,super,bf);
+      stop=bf!=0;
+    }
+    if(!stop)
+    {
+      child=super;
+      super=SUPER(tree,child);
+      dir=super&&NODE(tree,super).left==child?1:-1;
+    }
+  }
+  last=tree->size--;
+  if(node!=last)
+  {
+    NODE(tree,node)=NODE(tree,last);
+    ctreeRelink(tree,SUPER(tree,node),last,node);
+    if(NODE(tree,node).left) ctreeSetSuper(tree,NODE(tree,node).left,node);
+    if(NODE(tree,node).right) ctreeSetSuper(tree,NODE(tree,node).right,node);
+  }
+}
+
+//==============================================================================
+
+int ctreeRemove(CTreeMap tree,void* key,void** value,void(*del)(void*))
+{
+  int sig=0,result=0;
+  uint32_t aux,next;
+  for(aux=tree->root;aux&&(sig=tree->keyComp(key,NODE(tree,aux).key));
+      aux=sig<0?NODE(tree,aux).left:NODE(tree,aux).right);
+  if(!aux)
+  {
+    if(value) *value=NULL;
+    result=1;
+  }
+  else
+  {
+    if(del) del(NODE(tree,aux).key);
+    if(value) *value=NODE(tree,aux).value;
+    if(NODE(tree,aux).left&&NODE(tree,aux).right)
+    {
+      for(next=NODE(tree,aux).right;NODE(tree,next).left;
+          next=NODE(tree,next).left);
+      NODE(tree,aux).key=NODE(tree,next).key;
+      NODE(tree,aux).value=NODE(tree,next).value;
+      aux=next;
+    }
+    ctreeUnlink(tree,aux);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int ctreeGet(CTreeMap tree,void* key,void** value)
+{
+  int sig=0,result=0;
+  uint32_t aux;
+  for(aux=tree->root;aux&&(sig=tree->keyComp(key,NODE(tree,aux).key));
+      aux=sig<0?NODE(tree,aux).left:NODE(tree,aux).right);
+  if(!aux)
+  {
+    *value=NULL;
+    result=1;
+  }
+  else *value=NODE(tree,aux).value;
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Checks if a subtree is balanced, and if the balance factors are correct.
+ *
+ * @param tree the tree
+ * @param node the root index of the subtree
+ *
+ * @return
+ * -1 is the subtree is not balanced\n
+ * subtree height otherwise
+ */
+static int ctreeIsBalancedAux(CTreeMap tree,uint32_t node)
+{
+  int left,right,result=0;
+  if(node)
+  {
+    left=ctreeIsBalancedAux(tree,NODE(tree,node).left);
+    right=ctreeIsBalancedAux(tree,NODE(tree,node).right);
+    if(left<0||right<0||right-left!=BF(tree,node)) result=-1;
+    else result=left>right?left+1:right+1;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int ctreeIsBalanced(CTreeMap tree)
+{
+  return ctreeIsBalancedAux(tree,tree->root)==-1?0:1;
+}
+
+//==============================================================================
+
+int ctreeHeight(CTreeMap tree)
+{
+  int result=0;
+  uint32_t aux;
+  for(aux=tree->root;aux;result++)
+    aux=BF(tree,aux)>0?NODE(tree,aux).right:NODE(tree,aux).left;
+  return result;
+}
+
+//==============================================================================
+
+int ctreeSize(CTreeMap tree)
+{
+  return tree->size;
+}
+
+//==============================================================================
+
+/**
+ * Inorder traversal auxiliary function.
+ *
+ * @param tree the tree
+ * @param node the root index of the subtree
+ * @param fun  the function to be applied
+ */
+static void ctreeInOAux(CTreeMap tree,uint32_t node,void(*fun)(void*,void*))
+{
+  if(node)
+  {
+    ctreeInOAux(tree,NODE(tree,node).left,fun);
+    fun(NODE(tree,node).key,NODE(tree,node).value);
+    ctreeInOAux(tree,NODE(tree,node).right,fun);
+  }
+}
+
+//==============================================================================
+
+int ctreeInOrder(CTreeMap tree,void(*fun)(void*,void*))
+{
+  int result=0;
+  if(!tree->size) result=1;
+  else ctreeInOAux(tree,tree->root,fun);
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Traverses a subtree and adds the keys or the values to an iterator.
+ *
+ * @param tree the tree
+ * @param node the root index of the subtree
+ * @param keys specifies whether keys (<tt>keys!=0</tt>) or values shall be
+ * added
+ * @param it   the iterator
+ *
+ * @return
+ * 1 if an error occurred\n
+ * 0 otherwise
+ */
+static int ctreeItAux(CTreeMap tree,uint32_t node,int keys,Iterator it)
+{
+  int result=0;
+  if(node)
+  {
+    result=ctreeItAux(tree,NODE(tree,node).left,keys,it);
+    result=result||itAdd(it,keys?NODE(tree,node).key:NODE(tree,node).value);
+    result=result||ctreeItAux(tree,NODE(tree,node).right,keys,it);
+  }
+  return result;
+}
+
+//==============================================================================
+
+Iterator ctreeKeys(CTreeMap tree)
+{
+  Iterator it=newIt(tree->size);
+  if(it&&ctreeItAux(tree,tree->root,1,it))
+  {
+    itDelete(it);
+    it=NULL;
+  }
+  return it;
+}
+
+//==============================================================================
+
+Iterator ctreeValues(CTreeMap tree)
+{
+  Iterator it=newIt(tree->size);
+  if(it&&ctreeItAux(tree,tree->root,0,it))
+  {
+    itDelete(it);
+    it=NULL;
+  }
+  return it;
+}
@@ -0,0 +1,261 @@
+/**
+ * Implementation of a compact AVL tree (self-balancing binary search tree).
+ *
+ * Provides functions to create and manipulate an AVL tree whose nodes are
+ * stored in a single growable array.  Nodes refer to each other using 32-bit
+ * indexes instead of pointers, and the balance factor of each node is packed
+ * into the spare bits of its parent index, so that each node uses 32 bytes on
+ * 64-bit platforms (instead of the 48 bytes, plus allocation overhead, of a
+ * <tt>@ref TreeMap</tt> node).  Since the tree is a single block of memory, it
+ * can be copied with a single <tt>memcpy</tt> (see <tt>@ref ctreeClone</tt>).
+ *
+ * A tree can hold at most <tt>@ref CTREE_MAX</tt> elements.
+ *
+ * The key comparison function has the same semantics as the one used by
+ * <tt>@ref TreeMap</tt>.
+ *
+ * @attention
+ * Removing an element may move other nodes inside the array.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ctreemap.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _CTREEMAP_H_
+#define _CTREEMAP_H_
+
+#include <stdint.h>
+#include "iterator.h"
+#include "treemap.h"
+
+/**
+ * Maximum number of elements of a compact tree.
+ */
+#define CTREE_MAX 0x3FFFFFFF
+
+/**
+ * Compact tree node structure.
+ *
+ * Index 0 is used as the null index.
+ */
+typedef struct sCTreeNode
+{
+  ///Node's key.
+  void* key;
+  ///Node's value.
+  void* value;
+  ///Node's parent index (lower 30 bits) and balance factor (upper 2 bits).
+  uint32_t super;
+  ///Node's left subtree index.
+  uint32_t left;
+  ///Node's right subtree index.
+  uint32_t right;
+}SCTreeNode;
+
+/**
+ * Compact tree structure.
+ */
+typedef struct sCTreeMap
+{
+  ///Key comparison function of this tree.
+  int(*keyComp)(void*,void*);
+  ///Number of elements of this tree.
+  int size;
+  ///Number of elements this tree can hold without growing.
+  int capacity;
+  ///Root node index of this tree.
+  uint32_t root;
+  ///Nodes of this tree (at positions 1 to <tt>size</tt>).
+  SCTreeNode* nodes;
+}SCTreeMap;
+
+/**
+ * Compact tree definition.
+ */
+typedef SCTreeMap* CTreeMap;
+
+//==============================================================================
+
+/**
+ * Creates a compact tree.
+ *
+ * @param keyComp the comparison function
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new tree otherwise
+ */
+CTreeMap newCTree(int(*keyComp)(void*,void*));
+
+/**
+ * Creates a copy of a compact tree.
+ *
+ * The new tree contains the same keys and values (the elements themselves are
+ * not copied).
+ *
+ * @param tree the tree
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new tree otherwise
+ */
+CTreeMap ctreeClone(CTreeMap tree);
+
+/**
+ * Sets the comparison function of this tree.
+ *
+ * @param tree    the tree
+ * @param keyComp the new comparison function
+ *
+ * @return
+ * 1 if <tt>keyComp</tt> was equal to <tt>NULL</tt> (no change was made)\n
+ * 0 otherwise
+ */
+int ctreeSetKComp(CTreeMap tree,int(*keyComp)(void*,void*));
+
+/**
+ * Deletes a compact tree.
+ *
+ * @attention
+ * This function only free the memory used by the tree.  It does not free the
+ * memory used by elements the tree contains.
+ *
+ * @param tree the tree to be deleted
+ */
+void ctreeDelete(CTreeMap tree);
+
+/**
+ * Associates a value to a key in a compact tree.
+ *
+ * If the key already had a value, the <tt>replace</tt> argument specifies
+ * whether the new element should be added (it will be added only if
+ * <tt>replace!=0</tt>).
+ *
+ * @param tree    the tree
+ * @param key     the key
+ * @param value   the value to be inserted
+ * @param replace specifies whether an old value shall be replaced
+ *
+ * @return
+ * 0 if the value was inserted\n
+ * 1 if the key already had a value\n
+ * 2 if an error occurred
+ */
+int ctreeInsert(CTreeMap tree,void* key,void* value,int replace);
+
+/**
+ * Removes the mapping for a key from a compact tree.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ * To free the memory used by its key, you have to provide the argument
+ * <tt>del</tt>.
+ *
+ * @param tree  the tree
+ * @param key   key whose mapping is to be removed
+ * @param value pointer where the removed element shall be put (or
+ * <tt>NULL</tt>)
+ * @param del   function to free the memory used by the key (or <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 otherwise
+ */
+int ctreeRemove(CTreeMap tree,void* key,void** value,void(*del)(void*));
+
+/**
+ * Provides the mapping for a key from a compact tree.
+ *
+ * If there is no mapping for the specified key, it will be put the value
+ * <tt>NULL</tt> at <tt>value</tt>.  However, the <tt>NULL</tt> value may also
+ * say that the mapping for the specified key was <tt>NULL</tt>.  Check the
+ * returned value in order to know whether the key was in the tree.
+ *
+ * @param tree  the tree
+ * @param key   key whose mapping is to be provided
+ * @param value pointer where the mapping value will be put
+ *
+ * @return
+ * 0 if there was a mapping for the specified key\n
+ * 1 otherwise
+ */
+int ctreeGet(CTreeMap tree,void* key,void** value);
+
+/**
+ * Checks if a compact tree is balanced.
+ *
+ * @see treeIsBalanced
+ *
+ * @param tree the tree
+ *
+ * @return
+ * 0 if the tree is not balanced\n
+ * 1 otherwise
+ */
+int ctreeIsBalanced(CTreeMap tree);
+
+/**
+ * Returns the height of a compact tree.
+ *
+ * @param tree the tree
+ *
+ * @return
+ * the height of the tree
+ */
+int ctreeHeight(CTreeMap tree);
+
+/**
+ * Returns the number of elements present in a compact tree.
+ *
+ * @param tree the tree
+ *
+ * @return
+ * the number of elements present in the tree
+ */
+int ctreeSize(CTreeMap tree);
+
+/**
+ * Applies a function to the elements of a compact tree (inorder traversal).
+ *
+ * The function to be applied must be of type <tt>void fun(void*,void*)</tt>.
+ *
+ * @param tree the tree
+ * @param fun  the function to be applied
+ *
+ * @return
+ * 0 if the tree was not empty\n
+ * 1 otherwise
+ */
+int ctreeInOrder(CTreeMap tree,void(*fun)(void*,void*));
+
+/**
+ * Creates an iterator from the keys of a compact tree.
+ *
+ * @see Iterator
+ *
+ * @param tree the tree
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator ctreeKeys(CTreeMap tree);
+
+/**
+ * Creates an iterator from the values of a compact tree.
+ *
+ * @see Iterator
+ *
+ * @param tree the tree
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator ctreeValues(CTreeMap tree);
+
+#endif
@@ -0,0 +1,290 @@
+/**
+ * Implementation of a double-ended queue as a circular map of blocks.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file deque.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include "deque.h"
+
+/**
+ * Given a deque (<tt>D</tt>) and an index (<tt>I</tt>), provides the position
+ * of the corresponding element.
+ */
+#define POS(D,I) (((D)->first+(I))&((D)->blocks*DEQUE_BLOCK-1))
+
+/**
+ * Given a deque (<tt>D</tt>) and a position (<tt>P</tt>), provides the
+ * corresponding slot.
+ */
+#define SLOT(D,P) ((D)->map[(P)/DEQUE_BLOCK][(P)%DEQUE_BLOCK])
+
+Deque newDeque(void)
+{
+  Deque deque=malloc(sizeof(SDeque));
+  if(deque)
+  {
+    deque->map=calloc(DEQUE_BLOCKS,sizeof(void**));
+    if(!deque->map)
+    {
+      free(deque);
+      deque=NULL;
+    }
+    else
+    {
+      deque->size=0;
+      deque->blocks=DEQUE_BLOCKS;
+      deque->first=0;
+    }
+  }
+  return deque;
+}
+
+//==============================================================================
+
+void dequeDelete(Deque deque)
+{
+  int i;
+  for(i=0;i<deque->blocks;i++) free(deque->map[i]);
+  free(deque->map);
+  free(deque);
+}
+
+//==============================================================================
+
+/**
+ * Makes room for a new element in a deque, doubling the capacity of its map if
+ * needed, and allocating the block where the element will be put.
+ *
+ * The map is doubled when less than a free block would be left, so that the
+ * first and the last elements are never in the same block.  The blocks are
+ * copied to the new map starting from the block of the first element.
+ *
+ * @param deque the deque
+ * @param fst   whether the new element will be put before the first one
+ * @param pos   pointer where the position of the new element will be put
+ *
+ * @return
+ * 0 if there is room for the new element\n
+ * 1 if it was not possible to allocate memory
+ */
+static int dequeGrow(Deque deque,int fst,int* pos)
+{
+  int i,block,result=0;
+  void*** newmap;
+  if(deque->size>=(deque->blocks-1)*DEQUE_BLOCK)
+  {
+    if(deque->blocks>INT_MAX/DEQUE_BLOCK/4) result=1;
+    else
+    {
+      newmap=calloc(deque->blocks*2,sizeof(void**));
+      if(!newmap) result=1;
+      else
+      {
+        block=deque->first/DEQUE_BLOCK;
+        for(i=0;i<deque->blocks;i++)
+          newmap[i]=deque->map[(block+i)&(deque->blocks-1)];
+        free(deque->map);
+        deque->map=newmap;
+        deque->first%=DEQUE_BLOCK;
+        deque->blocks*=2;
+      }
+    }
+  }
+  if(!result)
+  {
+    *pos=POS(deque,fst?deque->blocks*DEQUE_BLOCK-1:deque->size);
+    block=*pos/DEQUE_BLOCK;
+    if(!deque->map[block])
+    {
+      deque->map[block]=malloc(DEQUE_BLOCK*sizeof(void*));
+      if(!deque->map[block]) result=1;
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+int dequeInsertFst(Deque deque,void* value)
+{
+  int pos,result=dequeGrow(deque,1,&pos);
+  if(!result)
+  {
+    SLOT(deque,pos)=value;
+    deque->first=pos;
+    deque->size++;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int dequeInsertLst(Deque deque,void* value)
+{
+  int pos,result=dequeGrow(deque,0,&pos);
+  if(!result)
+  {
+    SLOT(deque,pos)=value;
+    deque->size++;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int dequeRemoveFst(Deque deque,void** value)
+{
+  int result=0;
+  if(!deque->size)
+  {
+    if(value) *value=NULL;
+    result=1;
+  }
+  else
+  {
+    if(value) *value=SLOT(deque,deque->first);
+    deque->first=POS(deque,1);
+    deque->size--;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int dequeRemoveLst(Deque deque,void** value)
+{
+  int result=0;
+  if(!deque->size)
+  {
+    if(value) *value=NULL;
+    result=1;
+  }
+  else
+  {
+    deque->size--;
+    if(value) *value=SLOT(deque,POS(deque,deque->size));
+  }
+  return result;
+}
+
+//==============================================================================
+
+int dequeFst(Deque deque,void** value)
+{
+  return dequeAt(deque,0,value);
+}
+
+//==============================================================================
+
+int dequeLst(Deque deque,void** value)
+{
+  return dequeAt(deque,deque->size-1,value);
+}
+
+//==============================================================================
+
+int dequeAt(Deque deque,int index,void** value)
+{
+  int result=0;
+  if(index<0||index>=deque->size)
+  {
+    if(value) *value=NULL;
+    result=1;
+  }
+  else if(value) *value=SLOT(deque,POS(deque,index));
+  return result;
+}
+
+//==============================================================================
+
+int dequeSpan(Deque deque,int index,void*** values)
+{
+  int pos,n=0;
+  if(index<0||index>=deque->size) *values=NULL;
+  else
+  {
+    pos=POS(deque,index);
+    n=DEQUE_BLOCK-pos%DEQUE_BLOCK;
+    if(n>deque->size-index) n=deque->size-index;
+    *values=&SLOT(deque,pos);
+  }
+  return n;
+}
+
+//==============================================================================
+
+int dequeSize(Deque deque)
+{
+  return deque->size;
+}
+
+//==============================================================================
+
+int dequeMap(Deque deque,void(*fun)(void*))
+{
+  int i,j,n,result=0;
+  void** values;
+  if(!deque->size) result=1;
+  else
+  {
+    for(i=0;i<deque->size;i+=n)
+    {
+      n=dequeSpan(deque,i,&values);
+      for(j=0;j<n;j++) fun(values[j]);
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+Iterator dequeIterator(Deque deque)
+{
+  int i,n;
+  void** values;
+  Iterator it;
+  it=newIt(deque->size?deque->size:1);
+  if(it)
+  {
+    for(i=0;i<deque->size;i+=n)
+    {
+      n=dequeSpan(deque,i,&values);
+      memcpy(it->values+i,values,n*sizeof(void*));
+    }
+    it->size=deque->size;
+  }
+  return it;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator over a deque.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int dequeLazyNext(LazyIt it,void** val)
+{
+  int result=dequeAt(it->state[0],it->index[0],val);
+  if(!result) it->index[0]++;
+  return result;
+}
+
+//==============================================================================
+
+LazyIt dequeLazy(Deque deque)
+{
+  LazyIt it=newLazy(dequeLazyNext,NULL);
+  if(it) it->state[0]=deque;
+  return it;
+}
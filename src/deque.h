@@ -0,0 +1,272 @@
+/**
+ * Implementation of a double-ended queue as a circular map of blocks.
+ *
+ * Provides functions to create and manipulate a deque, where elements can be
+ * inserted and removed at both ends in constant time, and accessed by position
+ * in constant time.
+ *
+ * The elements are stored in fixed-size blocks of <tt>@ref DEQUE_BLOCK</tt>
+ * elements, which are referred by a circular map whose capacity is a power of
+ * two.  Elements are never moved: when the map is full, only the references to
+ * the blocks are copied to a map twice as large.  Blocks are allocated when
+ * first used, and kept for reuse until the deque is deleted, so that a deque
+ * used as a sliding window does not allocate memory once it reaches its
+ * maximum size.
+ *
+ * The elements of a block are contiguous, and can be traversed directly (see
+ * <tt>@ref dequeSpan</tt>).
+ *
+ * @author Rui Carlos Gonçalves
+ * @file deque.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _DEQUE_H_
+#define _DEQUE_H_
+
+#include "iterator.h"
+#include "lazyit.h"
+
+/**
+ * Number of elements of each block of a deque.
+ */
+#define DEQUE_BLOCK 64
+
+/**
+ * Initial capacity of the map of a deque (must be a power of two, not less
+ * than 2).
+ */
+#define DEQUE_BLOCKS 4
+
+/**
+ * Deque structure.
+ */
+typedef struct sDeque
+{
+  ///Number of elements of this deque.
+  int size;
+  ///Capacity of the map of this deque (a power of two).
+  int blocks;
+  ///Position of the first element.
+  int first;
+  ///Map of blocks of this deque (unused blocks may be <tt>NULL</tt>).
+  void*** map;
+}SDeque;
+
+/**
+ * Deque definition.
+ */
+typedef SDeque* Deque;
+
+//==============================================================================
+
+/**
+ * Creates a deque.
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new deque otherwise
+ */
+Deque newDeque(void);
+
+/**
+ * Deletes a deque.
+ *
+ * @attention
+ * This function only frees the memory used by the deque.  It does not free the
+ * memory used by elements the deque contains.
+ *
+ * @param deque the deque to be deleted
+ */
+void dequeDelete(Deque deque);
+
+/**
+ * Inserts an element at the beginning of a deque.
+ *
+ * @param deque the deque
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if it was not possible to insert the new element
+ */
+int dequeInsertFst(Deque deque,void* value);
+
+/**
+ * Inserts an element at the end of a deque.
+ *
+ * @param deque the deque
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if it was not possible to insert the new element
+ */
+int dequeInsertLst(Deque deque,void* value);
+
+/**
+ * Removes the first element of a deque.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param deque the deque
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the deque was empty
+ */
+int dequeRemoveFst(Deque deque,void** value);
+
+/**
+ * Removes the last element of a deque.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param deque the deque
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the deque was empty
+ */
+int dequeRemoveLst(Deque deque,void** value);
+
+/**
+ * Provides the value at the first position of a deque.
+ *
+ * If the deque is empty, it will be put the value <tt>NULL</tt> at
+ * <tt>value</tt>.
+ *
+ * @param deque the deque
+ * @param value pointer where the value at the first position will be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the deque was not empty\n
+ * 1 otherwise
+ */
+int dequeFst(Deque deque,void** value);
+
+/**
+ * Provides the value at the last position of a deque.
+ *
+ * If the deque is empty, it will be put the value <tt>NULL</tt> at
+ * <tt>value</tt>.
+ *
+ * @param deque the deque
+ * @param value pointer where the value at the last position will be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the deque was not empty\n
+ * 1 otherwise
+ */
+int dequeLst(Deque deque,void** value);
+
+/**
+ * Provides the element at the specified position of a deque.
+ *
+ * If there is no element at the specified position, it will be put the value
+ * <tt>NULL</tt> at <tt>value</tt>.
+ *
+ * @param deque the deque
+ * @param index the index of the element to be provided
+ * @param value pointer where the value at the specified position will be put
+ * (or <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if there was an element at the specified position\n
+ * 1 otherwise
+ */
+int dequeAt(Deque deque,int index,void** value);
+
+/**
+ * Provides the address of the elements of a deque that are stored
+ * contiguously from the specified position (up to the end of its block).
+ *
+ * E.g.:
+\code
+void** vals;
+int i,n;
+for(i=0;i<dequeSize(deque);i+=n)
+{
+  n=dequeSpan(deque,i,&vals);
+  sum+=sumAll(vals,n);
+}
+\endcode
+ *
+ * @attention
+ * The address is only valid until the deque is changed.
+ *
+ * @param deque  the deque
+ * @param index  the index of the first element
+ * @param values pointer where the address of the elements will be put
+ *
+ * @return
+ * the number of contiguous elements (0 if the value of <tt>index</tt> was
+ * invalid)
+ */
+int dequeSpan(Deque deque,int index,void*** values);
+
+/**
+ * Returns the size of a deque.
+ *
+ * @param deque the deque
+ *
+ * @return
+ * the size of the deque
+ */
+int dequeSize(Deque deque);
+
+/**
+ * Applies a function to the elements of a deque.
+ *
+ * The function to be applied must be of type <tt>void fun(void*)</tt>.
+ *
+ * @param deque the deque
+ * @param fun   the function to be applied
+ *
+ * @return
+ * 0 if the deque was not empty\n
+ * 1 otherwise
+ */
+int dequeMap(Deque deque,void(*fun)(void*));
+
+/**
+ * Creates an iterator from a deque.
+ *
+ * @see Iterator
+ *
+ * @param deque the deque
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator dequeIterator(Deque deque);
+
+/**
+ * Creates a lazy iterator from a deque.
+ *
+ * @see LazyIt
+ *
+ * @param deque the deque
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt dequeLazy(Deque deque);
+
+#endif
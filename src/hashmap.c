@@ -164,6 +164,41 @@ int hashInsert(HashMap hmap,void* key,void* value,int replace)
 
 //==============================================================================
 
+int hashUpsert(HashMap hmap,void* key,void(*fun)(void*,void**))
+{
+  int h,error=0,result=0;
+  HashNode aux;
+  if(hmap->size>hmap->factor*hmap->length) error=reHash(hmap);
+  if(!error)
+  {
+    h=(hmap->hash)(key)%hmap->length;
+    for(aux=hmap->elems[h];aux&&(hmap->equals)(aux->key,key);aux=aux->next);
+    if(aux)
+    {
+      if(fun) fun(aux->key,&aux->value);
+      result=1;
+    }
+    else
+    {
+      aux=malloc(sizeof(SHashNode));
+      if(aux)
+      {
+        aux->key=key;
+        aux->value=NULL;
+        aux->next=hmap->elems[h];
+        hmap->elems[h]=aux;
+        hmap->size++;
+        if(fun) fun(key,&aux->value);
+      }
+      else result=2;
+    }
+  }
+  else result=2;
+  return result;
+}
+
+//==============================================================================
+
 int hashRemove(HashMap hmap,void* key,void** value,void(*del)(void*))
 {
   int index,result=0;
@@ -254,3 +289,98 @@ Iterator hashValues(HashMap hmap)
   }
   return it;
 }
+
+//==============================================================================
+
+/**
+ * Provides the next key or value of a lazy iterator over a hash table.
+ *
+ * The state of the iterator holds the hash table, the next node, the next
+ * bucket, whether keys (<tt>index[1]!=0</tt>) or values shall be provided, and
+ * the bucket where the iteration stops.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int hashLazyNext(LazyIt it,void** val)
+{
+  int result=0;
+  HashMap hmap=it->state[0];
+  HashNode aux=it->state[1];
+  for(;!aux&&it->index[0]<it->index[2];aux=hmap->elems[it->index[0]++]);
+  if(!aux) result=1;
+  else
+  {
+    *val=it->index[1]?aux->key:aux->value;
+    it->state[1]=aux->next;
+  }
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Splits the buckets of a hash table into disjoint lazy iterators.
+ *
+ * @param hmap  the hash table
+ * @param n     the maximum number of parts
+ * @param parts array where the lazy iterators will be put
+ * @param keys  specifies whether keys (<tt>keys!=0</tt>) or values shall be
+ * provided
+ *
+ * @return
+ * -1 if an error occurred\n
+ * the number of lazy iterators created otherwise
+ */
+static int hashSplitAux(HashMap hmap,int n,LazyIt* parts,int keys)
+{
+  int i,result;
+  result=n<1?-1:hmap->length<n?hmap->length:n;
+  for(i=0;i<result&&(parts[i]=newLazy(hashLazyNext,NULL));i++)
+  {
+    parts[i]->state[0]=hmap;
+    parts[i]->index[0]=(int)((long)hmap->length*i/result);
+    parts[i]->index[1]=keys;
+    parts[i]->index[2]=(int)((long)hmap->length*(i+1)/result);
+  }
+  if(i<result)
+  {
+    while(i>0) lazyDelete(parts[--i]);
+    result=-1;
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt hashLazyKeys(HashMap hmap)
+{
+  LazyIt it;
+  return hashSplitAux(hmap,1,&it,1)==1?it:NULL;
+}
+
+//==============================================================================
+
+LazyIt hashLazyValues(HashMap hmap)
+{
+  LazyIt it;
+  return hashSplitAux(hmap,1,&it,0)==1?it:NULL;
+}
+
+//==============================================================================
+
+int hashSplitKeys(HashMap hmap,int n,LazyIt* parts)
+{
+  return hashSplitAux(hmap,n,parts,1);
+}
+
+//==============================================================================
+
+int hashSplitValues(HashMap hmap,int n,LazyIt* parts)
+{
+  return hashSplitAux(hmap,n,parts,0);
+}
@@ -57,6 +57,7 @@ int keyEquals(void* key1,void* key2)
 #define _HASHMAP_H_
 
 #include "iterator.h"
+#include "lazyit.h"
 
 /**
  * Hash table node structure.
@@ -192,6 +193,33 @@ void hashDelete(HashMap hmap);
  */
 int hashInsert(HashMap hmap,void* key,void* value,int replace);
 
+/**
+ * Inserts or updates the mapping for a key in a hash table, computing the hash
+ * of the key only once.
+ *
+ * The function <tt>fun</tt>, of type <tt>void fun(void* key,void** value)</tt>,
+ * is applied to the key and to a pointer to the value slot associated to it.
+ * If the key was not in the hash table, a new mapping is created with value
+ * <tt>NULL</tt> before <tt>fun</tt> is applied, so that <tt>fun</tt> may
+ * initialize it.  Otherwise, <tt>fun</tt> receives the key stored in the hash
+ * table and may modify the existing value in place.
+ * If <tt>fun</tt> is <tt>NULL</tt>, the function behaves as a plain insertion:
+ * a missing key is mapped to <tt>NULL</tt>, and an existing value is left
+ * unchanged.
+ *
+ * @see treeUpsert
+ *
+ * @param hmap the hash table
+ * @param key  the key
+ * @param fun  function to be applied to the value slot (or <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if a new mapping was created\n
+ * 1 if the key already had a value\n
+ * 2 if an error occurred
+ */
+int hashUpsert(HashMap hmap,void* key,void(*fun)(void*,void**));
+
 /**
  * Removes the mapping for a key from a hash table.
  *
@@ -274,4 +302,72 @@ Iterator hashKeys(HashMap hmap);
  */
 Iterator hashValues(HashMap hmap);
 
+/**
+ * Creates a lazy iterator from the keys of a hash table.
+ *
+ * @see LazyIt
+ *
+ * @param hmap the hash table
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt hashLazyKeys(HashMap hmap);
+
+/**
+ * Creates a lazy iterator from the values of a hash table.
+ *
+ * @see LazyIt
+ *
+ * @param hmap the hash table
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt hashLazyValues(HashMap hmap);
+
+/**
+ * Splits the keys of a hash table into disjoint lazy iterators, which can be
+ * consumed concurrently.
+ *
+ * The buckets are split into at most <tt>n</tt> contiguous ranges with the
+ * same number of buckets.
+ *
+ * @see LazyIt
+ *
+ * @param hmap  the hash table
+ * @param n     the maximum number of parts (a positive number)
+ * @param parts array where the lazy iterators will be put (with at least
+ * <tt>n</tt> positions)
+ *
+ * @return
+ * -1 if an error occurred, or <tt>n</tt> was not positive (no lazy iterator is
+ * created)\n
+ * the number of lazy iterators created otherwise
+ */
+int hashSplitKeys(HashMap hmap,int n,LazyIt* parts);
+
+/**
+ * Splits the values of a hash table into disjoint lazy iterators, which can be
+ * consumed concurrently.
+ *
+ * The buckets are split into at most <tt>n</tt> contiguous ranges with the
+ * same number of buckets.
+ *
+ * @see LazyIt
+ *
+ * @param hmap  the hash table
+ * @param n     the maximum number of parts (a positive number)
+ * @param parts array where the lazy iterators will be put (with at least
+ * <tt>n</tt> positions)
+ *
+ * @return
+ * -1 if an error occurred, or <tt>n</tt> was not positive (no lazy iterator is
+ * created)\n
+ * the number of lazy iterators created otherwise
+ */
+int hashSplitValues(HashMap hmap,int n,LazyIt* parts);
+
 #endif
@@ -0,0 +1,286 @@
+/**
+ * Implementation of a priority queue as a d-ary heap.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file heap.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include "heap.h"
+
+/**
+ * Given a heap (<tt>H</tt>) and a position (<tt>I</tt>), provides the position
+ * of its parent.
+ */
+#define PARENT(H,I) (((I)-1)/(H)->arity)
+
+/**
+ * Given a heap (<tt>H</tt>) and a position (<tt>I</tt>), provides the position
+ * of its first child.
+ */
+#define CHILD(H,I) ((I)*(H)->arity+1)
+
+Heap newHeap(int arity,int(*comp)(void*,void*))
+{
+  Heap heap=NULL;
+  if(arity>=2&&comp)
+  {
+    heap=malloc(sizeof(SHeap));
+    if(heap)
+    {
+      heap->entries=malloc(HEAP_CAPACITY*sizeof(SHeapEntry));
+      if(!heap->entries)
+      {
+        free(heap);
+        heap=NULL;
+      }
+      else
+      {
+        heap->arity=arity;
+        heap->size=0;
+        heap->capacity=HEAP_CAPACITY;
+        heap->comp=comp;
+      }
+    }
+  }
+  return heap;
+}
+
+//==============================================================================
+
+void heapDelete(Heap heap)
+{
+  free(heap->entries);
+  free(heap);
+}
+
+//==============================================================================
+
+/**
+ * Ensures that a heap can hold the specified number of elements, doubling its
+ * capacity as needed.
+ *
+ * @param heap the heap
+ * @param size the number of elements
+ *
+ * @return
+ * 0 if the heap can hold <tt>size</tt> elements\n
+ * 1 otherwise
+ */
+static int heapReserve(Heap heap,int size)
+{
+  int capacity=heap->capacity,result=0;
+  SHeapEntry* newentries;
+  for(;capacity<size&&capacity<=INT_MAX/2;capacity*=2);
+  if(capacity<size) capacity=size;
+  if(capacity>heap->capacity)
+  {
+    newentries=realloc(heap->entries,capacity*sizeof(SHeapEntry));
+    if(!newentries) result=1;
+    else
+    {
+      heap->entries=newentries;
+      heap->capacity=capacity;
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Puts an entry at a position of a heap, updating its handle.
+ *
+ * @param heap  the heap
+ * @param index the position
+ * @param entry the entry
+ */
+static void heapSet(Heap heap,int index,SHeapEntry entry)
+{
+  heap->entries[index]=entry;
+  if(entry.handle) entry.handle->index=index;
+}
+
+//==============================================================================
+
+/**
+ * Moves the entry at a position of a heap up, while it is less than its
+ * parent.
+ *
+ * @param heap  the heap
+ * @param index the position
+ *
+ * @return
+ * the final position of the entry
+ */
+static int heapSiftUp(Heap heap,int index)
+{
+  int parent;
+  SHeapEntry entry=heap->entries[index];
+  for(parent=PARENT(heap,index);
+      index>0&&heap->comp(entry.value,heap->entries[parent].value)<0;
+      index=parent,parent=PARENT(heap,index))
+    heapSet(heap,index,heap->entries[parent]);
+  heapSet(heap,index,entry);
+  return index;
+}
+
+//==============================================================================
+
+/**
+ * Moves the entry at a position of a heap down, while it is greater than its
+ * least child.
+ *
+ * @param heap  the heap
+ * @param index the position
+ */
+static void heapSiftDown(Heap heap,int index)
+{
+  int i,child,last,stop=0;
+  SHeapEntry entry=heap->entries[index];
+  while(!stop)
+  {
+    child=CHILD(heap,index);
+    if(child>=heap->size) stop=1;
+    else
+    {
+      last=child+heap->arity<heap->size?child+heap->arity:heap->size;
+      for(i=child+1;i<last;i++)
+        if(heap->comp(heap->entries[i].value,heap->entries[child].value)<0)
+          child=i;
+      if(heap->comp(heap->entries[child].value,entry.value)<0)
+      {
+        heapSet(heap,index,heap->entries[child]);
+        index=child;
+      }
+      else stop=1;
+    }
+  }
+  heapSet(heap,index,entry);
+}
+
+//==============================================================================
+
+int heapPush(Heap heap,void* value,HeapHandle handle)
+{
+  int result=heapReserve(heap,heap->size+1);
+  if(!result)
+  {
+    heap->entries[heap->size].value=value;
+    heap->entries[heap->size].handle=handle;
+    heap->size++;
+    heapSiftUp(heap,heap->size-1);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int heapBuild(Heap heap,void** values,int n)
+{
+  int i,result=0;
+  if(n>0)
+  {
+    if(n>INT_MAX-heap->size||heapReserve(heap,heap->size+n)) result=1;
+    else
+    {
+      for(i=0;i<n;i++)
+      {
+        heap->entries[heap->size+i].value=values[i];
+        heap->entries[heap->size+i].handle=NULL;
+      }
+      heap->size+=n;
+      for(i=PARENT(heap,heap->size-1);i>=0;i--) heapSiftDown(heap,i);
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+int heapPop(Heap heap,void** value)
+{
+  int result=0;
+  if(!heap->size)
+  {
+    if(value) *value=NULL;
+    result=1;
+  }
+  else
+  {
+    if(value) *value=heap->entries[0].value;
+    if(heap->entries[0].handle) heap->entries[0].handle->index=-1;
+    heap->size--;
+    if(heap->size)
+    {
+      heap->entries[0]=heap->entries[heap->size];
+      heapSiftDown(heap,0);
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+int heapPeek(Heap heap,void** value)
+{
+  int result=0;
+  if(!heap->size)
+  {
+    if(value) *value=NULL;
+    result=1;
+  }
+  else if(value) *value=heap->entries[0].value;
+  return result;
+}
+
+//==============================================================================
+
+int heapUpdate(Heap heap,HeapHandle handle)
+{
+  int index=handle->index,result=0;
+  if(index<0||index>=heap->size||heap->entries[index].handle!=handle)
+    result=1;
+  else if(heapSiftUp(heap,index)==index) heapSiftDown(heap,index);
+  return result;
+}
+
+//==============================================================================
+
+int heapSize(Heap heap)
+{
+  return heap->size;
+}
+
+//==============================================================================
+
+int heapMap(Heap heap,void(*fun)(void*))
+{
+  int i,result=0;
+  if(!heap->size) result=1;
+  else
+  {
+    for(i=0;i<heap->size;i++)
+      fun(heap->entries[i].value);
+  }
+  return result;
+}
+
+//==============================================================================
+
+Iterator heapIterator(Heap heap)
+{
+  int i,ctrl;
+  Iterator it;
+  it=newIt(heap->size);
+  for(i=0,ctrl=0;i<heap->size&&!ctrl;i++)
+    ctrl=itAdd(it,heap->entries[i].value);
+  if(ctrl)
+  {
+    itDelete(it);
+    it=NULL;
+  }
+  return it;
+}
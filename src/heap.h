@@ -0,0 +1,239 @@
+/**
+ * Implementation of a priority queue as a d-ary heap.
+ *
+ * Provides functions to create and manipulate a priority queue, where the
+ * element removed first is the least one, according to a comparison function.
+ * The elements are stored in an array, as a complete tree where each node has
+ * up to <i>d</i> children (the arity of the heap).
+ *
+ * The comparison function must be of type <tt>int comp(void*,void*)</tt>, and
+ * its result should be greater than 0 if the first argument is greater than the
+ * second, 0 if they are equal, and less than 0 otherwise.
+ *
+ * The position of an element in the heap can be tracked using a handle (see
+ * <tt>@ref SHeapHandle</tt>), so that its priority can be changed:
+ *
+ * \code
+SHeapHandle handle;
+heapPush(heap,task,&handle);
+task->priority=0;
+heapUpdate(heap,&handle);
+ * \endcode
+ *
+ * @author Rui Carlos Gonçalves
+ * @file heap.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _HEAP_H_
+#define _HEAP_H_
+
+#include "iterator.h"
+
+/**
+ * Initial capacity of a heap.
+ */
+#define HEAP_CAPACITY 16
+
+/**
+ * Heap handle structure.
+ *
+ * Handles are owned by the user (e.g. embedded in the elements), and are
+ * updated by the heap while the corresponding element is in the heap.
+ */
+typedef struct sHeapHandle
+{
+  ///Position of the element in the heap (-1 if it is not in the heap).
+  int index;
+}SHeapHandle;
+
+/**
+ * Heap handle definition.
+ */
+typedef SHeapHandle* HeapHandle;
+
+/**
+ * Heap entry structure.
+ */
+typedef struct sHeapEntry
+{
+  ///Entry's value.
+  void* value;
+  ///Entry's handle (or <tt>NULL</tt>).
+  HeapHandle handle;
+}SHeapEntry;
+
+/**
+ * Heap structure.
+ */
+typedef struct sHeap
+{
+  ///Number of children of each node.
+  int arity;
+  ///Number of elements of this heap.
+  int size;
+  ///Current capacity of this heap.
+  int capacity;
+  ///Comparison function of this heap.
+  int(*comp)(void*,void*);
+  ///Entries of this heap.
+  SHeapEntry* entries;
+}SHeap;
+
+/**
+ * Heap definition.
+ */
+typedef SHeap* Heap;
+
+//==============================================================================
+
+/**
+ * Creates a heap.
+ *
+ * The arity must be at least 2 (a binary heap).  Arities such as 4 reduce the
+ * height of the heap, and make insertions faster.  The comparison function
+ * must not be <tt>NULL</tt>.
+ *
+ * @param arity the number of children of each node
+ * @param comp  the comparison function
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new heap otherwise
+ */
+Heap newHeap(int arity,int(*comp)(void*,void*));
+
+/**
+ * Deletes a heap.
+ *
+ * @attention
+ * This function only frees the memory used by the heap.  It does not free the
+ * memory used by elements the heap contains.
+ *
+ * @param heap the heap to be deleted
+ */
+void heapDelete(Heap heap);
+
+/**
+ * Inserts an element in a heap.
+ *
+ * If <tt>handle</tt> is not <tt>NULL</tt>, it will be kept up to date with
+ * the position of the element, while the element is in the heap.
+ *
+ * @param heap   the heap
+ * @param value  the value to be inserted
+ * @param handle the handle of the element (or <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if it was not possible to insert the new element
+ */
+int heapPush(Heap heap,void* value,HeapHandle handle);
+
+/**
+ * Inserts several elements in a heap, and restores the heap order once.
+ *
+ * Takes O(n) time, where <tt>n</tt> is the final size of the heap, which is
+ * faster than inserting the elements one by one.  The elements have no
+ * handles.
+ *
+ * @param heap   the heap
+ * @param values the values to be inserted
+ * @param n      the number of values
+ *
+ * @return
+ * 0 if the new values were inserted\n
+ * 1 if it was not possible to insert the new elements
+ */
+int heapBuild(Heap heap,void** values,int n);
+
+/**
+ * Removes the least element of a heap.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param heap  the heap
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 if the heap was empty
+ */
+int heapPop(Heap heap,void** value);
+
+/**
+ * Provides the least element of a heap.
+ *
+ * Provides the value of the least element if the value of <tt>value</tt> is not
+ * <tt>NULL</tt>.  If the heap is empty, it will be put the value <tt>NULL</tt>
+ * at <tt>value</tt>.
+ *
+ * @param heap  the heap
+ * @param value pointer where the least value will be put (or <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the heap was not empty\n
+ * 1 otherwise
+ */
+int heapPeek(Heap heap,void** value);
+
+/**
+ * Restores the heap order after the priority of an element was changed.
+ *
+ * Supports both decreasing and increasing the priority of the element.
+ *
+ * @param heap   the heap
+ * @param handle the handle of the element
+ *
+ * @return
+ * 0 if the heap order was restored\n
+ * 1 if the element was not in the heap
+ */
+int heapUpdate(Heap heap,HeapHandle handle);
+
+/**
+ * Returns the size of a heap.
+ *
+ * @param heap the heap
+ *
+ * @return
+ * the size of the heap
+ */
+int heapSize(Heap heap);
+
+/**
+ * Applies a function to the elements of a heap.
+ *
+ * The function to be applied must be of type <tt>void fun(void*)</tt>.  The
+ * order in which the elements are visited is not specified.
+ *
+ * @param heap the heap
+ * @param fun  the function to be applied
+ *
+ * @return
+ * 0 if the heap was not empty\n
+ * 1 otherwise
+ */
+int heapMap(Heap heap,void(*fun)(void*));
+
+/**
+ * Creates an iterator from a heap.
+ *
+ * The order of the elements is not specified.
+ *
+ * @see Iterator
+ *
+ * @param heap the heap
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator heapIterator(Heap heap);
+
+#endif
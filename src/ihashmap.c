@@ -0,0 +1,253 @@
+/**
+ * Implementation of an intrusive hash table.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ihashmap.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include "ihashmap.h"
+
+/**
+ * Given a hash table (<tt>H</tt>) and an element (<tt>E</tt>), provides the
+ * link of the element.
+ */
+#define LINK(H,E) ((IHashLink)((char*)(E)+(H)->offset))
+
+/**
+ * Given a hash table (<tt>H</tt>) and a link (<tt>K</tt>), provides the
+ * element that contains the link.
+ */
+#define ELEM(H,K) ((void*)((char*)(K)-(H)->offset))
+
+/**
+ * Given a hash table (<tt>H</tt>) and a link (<tt>K</tt>), provides the key of
+ * the element that contains the link.
+ */
+#define KEY(H,K) ((H)->key(ELEM(H,K)))
+
+/**
+ * Given a hash table (<tt>H</tt>), a key (<tt>K</tt>), and a number of
+ * buckets (<tt>N</tt>), provides the bucket of the key.
+ */
+#define BUCKET(H,K,N) ((unsigned)(H)->hash(K)%(unsigned)(N))
+
+/**
+ * Resizes a hash table.
+ *
+ * Doubles the number of buckets of a hash table, and updates the positions of
+ * the elements.
+ *
+ * @param hmap the hash table
+ *
+ * @return
+ * 1 if an error occured\n
+ * 0 otherwise
+ */
+static int ireHash(IHashMap hmap)
+{
+  int i,index,result=0;
+  IHashLink* new=NULL;
+  IHashLink this,next;
+  new=calloc(hmap->length*2,sizeof(IHashLink));
+  if(!new) result=1;
+  else
+  {
+    for(i=0;i<hmap->length;i++)
+    {
+      for(this=hmap->elems[i];this;this=next)
+      {
+        next=this->next;
+        index=BUCKET(hmap,KEY(hmap,this),2*hmap->length);
+        this->next=new[index];
+        new[index]=this;
+      }
+    }
+    free(hmap->elems);
+    hmap->elems=new;
+    hmap->length=2*hmap->length;
+  }
+  return result;
+}
+
+//==============================================================================
+
+IHashMap newIHash(size_t offset,int size,float factor,void*(*key)(void*),
+    int(*hash)(void*),int(*equals)(void*,void*))
+{
+  IHashMap hmap=NULL;
+  if(key&&hash&&equals&&size>0)
+  {
+    hmap=malloc(sizeof(SIHashMap));
+    if(hmap)
+    {
+      hmap->offset=offset;
+      hmap->size=0;
+      hmap->length=size;
+      if(factor<0.1) hmap->factor=0.1;
+      else hmap->factor=factor;
+      hmap->key=*key;
+      hmap->hash=*hash;
+      hmap->equals=*equals;
+      hmap->elems=calloc(size,sizeof(IHashLink));
+      if(!hmap->elems)
+      {
+        free(hmap);
+        hmap=NULL;
+      }
+    }
+  }
+  return hmap;
+}
+
+//==============================================================================
+
+void ihashDelete(IHashMap hmap)
+{
+  free(hmap->elems);
+  free(hmap);
+}
+
+//==============================================================================
+
+int ihashInsert(IHashMap hmap,void* elem,int replace,void** old)
+{
+  int result=0;
+  void* key=hmap->key(elem);
+  IHashLink link=LINK(hmap,elem),*last;
+  if(hmap->size>hmap->factor*hmap->length) ireHash(hmap);
+  for(last=&(hmap->elems[BUCKET(hmap,key,hmap->length)]);
+      *last&&(hmap->equals)(key,KEY(hmap,*last));
+      last=&((*last)->next));
+  if(!*last)
+  {
+    if(old) *old=NULL;
+    link->next=NULL;
+    *last=link;
+    hmap->size++;
+  }
+  else
+  {
+    if(old) *old=ELEM(hmap,*last);
+    if(replace&&link!=*last)
+    {
+      link->next=(*last)->next;
+      (*last)->next=NULL;
+      *last=link;
+    }
+    result=1;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int ihashRemove(IHashMap hmap,void* key,void** elem)
+{
+  int result=0;
+  IHashLink aux,*last;
+  for(last=&(hmap->elems[BUCKET(hmap,key,hmap->length)]);
+      *last&&(hmap->equals)(key,KEY(hmap,*last));
+      last=&((*last)->next));
+  if(*last)
+  {
+    aux=*last;
+    *last=aux->next;
+    aux->next=NULL;
+    if(elem) *elem=ELEM(hmap,aux);
+    hmap->size--;
+  }
+  else
+  {
+    if(elem) *elem=NULL;
+    result=1;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int ihashRemoveElem(IHashMap hmap,void* elem)
+{
+  int result=0;
+  IHashLink link=LINK(hmap,elem),*last;
+  for(last=&(hmap->elems[BUCKET(hmap,hmap->key(elem),hmap->length)]);
+      *last&&*last!=link;
+      last=&((*last)->next));
+  if(*last)
+  {
+    *last=link->next;
+    link->next=NULL;
+    hmap->size--;
+  }
+  else result=1;
+  return result;
+}
+
+//==============================================================================
+
+int ihashGet(IHashMap hmap,void* key,void** elem)
+{
+  int result=0;
+  IHashLink aux;
+  for(aux=hmap->elems[BUCKET(hmap,key,hmap->length)];
+      aux&&(hmap->equals)(key,KEY(hmap,aux));
+      aux=aux->next);
+  if(aux) *elem=ELEM(hmap,aux);
+  else
+  {
+    *elem=NULL;
+    result=1;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int ihashSize(IHashMap hmap)
+{
+  return hmap->size;
+}
+
+//==============================================================================
+
+int ihashMap(IHashMap hmap,void(*fun)(void*))
+{
+  int i,result=0;
+  IHashLink aux,next;
+  if(!hmap->size) result=1;
+  else
+  {
+    for(i=0;i<hmap->length;i++)
+    {
+      for(aux=hmap->elems[i];aux;aux=next)
+      {
+        next=aux->next;
+        fun(ELEM(hmap,aux));
+      }
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+Iterator ihashIterator(IHashMap hmap)
+{
+  int i,error;
+  IHashLink aux;
+  Iterator it=newIt(hmap->size);
+  if(it)
+  {
+    for(i=0,error=0;i<hmap->length&&!error;i++)
+      for(aux=hmap->elems[i];aux&&!error;aux=aux->next)
+        error=itAdd(it,ELEM(hmap,aux));
+    if(error)
+    {
+      itDelete(it);
+      it=NULL;
+    }
+  }
+  return it;
+}
@@ -0,0 +1,230 @@
+/**
+ * Implementation of an intrusive hash table.
+ *
+ * Provides functions to create and manipulate a hash table whose links are
+ * embedded in the elements it contains, so that no memory is allocated when
+ * elements are inserted (except when the hash table is resized).
+ *
+ * To use this hash table, the elements must contain a field of type
+ * <tt>@ref SIHashLink</tt>, whose offset is provided when the hash table is
+ * created.  An element may contain several links, and thus belong to several
+ * hash tables (or other intrusive containers) at once.
+ *
+ * Besides the hash and comparison functions described in <tt>hashmap.h</tt>,
+ * a function <tt>void* key(void* elem)</tt>, which provides the key of an
+ * element, must be provided.
+ *
+ * E.g.:
+\code
+typedef struct sOrder
+{
+  char* id;
+  SIHashLink link;
+}SOrder;
+
+void* orderId(void* order)
+{
+  return ((SOrder*)order)->id;
+}
+
+IHashMap hmap=newIHash(offsetof(SOrder,link),64,0.75,orderId,hash,keyEquals);
+\endcode
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ihashmap.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _IHASHMAP_H_
+#define _IHASHMAP_H_
+
+#include <stddef.h>
+#include "iterator.h"
+
+/**
+ * Intrusive hash table link structure.
+ */
+typedef struct sIHashLink
+{
+  ///Next link.
+  struct sIHashLink* next;
+}SIHashLink;
+
+/**
+ * Intrusive hash table link definition.
+ */
+typedef SIHashLink* IHashLink;
+
+/**
+ * Intrusive hash table structure.
+ */
+typedef struct sIHashMap
+{
+  ///Offset of the link inside the elements.
+  size_t offset;
+  ///Function that provides the key of an element.
+  void*(*key)(void*);
+  ///Hash function of this hash table.
+  int(*hash)(void*);
+  ///Comparison function of this hash table.
+  int(*equals)(void*,void*);
+  ///Number of elements of this hash table.
+  int size;
+  ///Number of buckets of this hash table.
+  int length;
+  ///Load factor.
+  float factor;
+  ///Buckets of this hash table.
+  IHashLink* elems;
+}SIHashMap;
+
+/**
+ * Intrusive hash table definition.
+ */
+typedef SIHashMap* IHashMap;
+
+//==============================================================================
+
+/**
+ * Creates an intrusive hash table.
+ *
+ * @see newHash
+ *
+ * @param offset the offset of the link inside the elements
+ * @param size   the initial number of buckets
+ * @param factor the load factor
+ * @param key    the function that provides the key of an element
+ * @param hash   the hash function
+ * @param equals the comparison function
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new hash table otherwise
+ */
+IHashMap newIHash(size_t offset,int size,float factor
+                 ,void*(*key)(void*)
+                 ,int(*hash)(void*)
+                 ,int(*equals)(void*,void*)
+                 );
+
+/**
+ * Deletes an intrusive hash table.
+ *
+ * @attention
+ * This function only free the memory used by the hash table.  It does not free
+ * the memory used by elements the hash table contains.
+ *
+ * @param hmap the hash table to be deleted
+ */
+void ihashDelete(IHashMap hmap);
+
+/**
+ * Inserts an element in an intrusive hash table.
+ *
+ * If there was already an element with the same key, the <tt>replace</tt>
+ * argument specifies whether the new element should replace it (it will
+ * replace it only if <tt>replace!=0</tt>).  The element that was already in
+ * the hash table is provided if the value of <tt>old</tt> is not
+ * <tt>NULL</tt>.
+ *
+ * If it is not possible to increase the number of buckets, the element is
+ * inserted anyway.
+ *
+ * @param hmap    the hash table
+ * @param elem    the element to be inserted
+ * @param replace specifies whether an old element shall be replaced
+ * @param old     pointer where the element with the same key shall be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was inserted\n
+ * 1 if there was already an element with the same key
+ */
+int ihashInsert(IHashMap hmap,void* elem,int replace,void** old);
+
+/**
+ * Removes the element with the specified key from an intrusive hash table.
+ *
+ * Provides the removed element if the value of <tt>elem</tt> is not
+ * <tt>NULL</tt>.
+ *
+ * @param hmap the hash table
+ * @param key  key whose element is to be removed
+ * @param elem pointer where the removed element shall be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 otherwise
+ */
+int ihashRemove(IHashMap hmap,void* key,void** elem);
+
+/**
+ * Removes an element from an intrusive hash table.
+ *
+ * Unlike <tt>@ref ihashRemove</tt>, the element to be removed is identified by
+ * its address, and thus key comparisons are not needed.
+ *
+ * @param hmap the hash table
+ * @param elem the element to be removed
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the element was not in the hash table
+ */
+int ihashRemoveElem(IHashMap hmap,void* elem);
+
+/**
+ * Provides the element with the specified key from an intrusive hash table.
+ *
+ * If there is no element with the specified key, it will be put the value
+ * <tt>NULL</tt> at <tt>elem</tt>.
+ *
+ * @param hmap the hash table
+ * @param key  key whose element is to be provided
+ * @param elem pointer where the element will be put
+ *
+ * @return
+ * 0 if there was an element with the specified key\n
+ * 1 otherwise
+ */
+int ihashGet(IHashMap hmap,void* key,void** elem);
+
+/**
+ * Returns the number of elements present in an intrusive hash table.
+ *
+ * @param hmap the hash table
+ *
+ * @return
+ * the number of elements present in the hash table
+ */
+int ihashSize(IHashMap hmap);
+
+/**
+ * Applies a function to the elements of an intrusive hash table.
+ *
+ * The function to be applied must be of type <tt>void fun(void*)</tt>.
+ *
+ * @param hmap the hash table
+ * @param fun  the function to be applied
+ *
+ * @return
+ * 0 if the hash table was not empty\n
+ * 1 otherwise
+ */
+int ihashMap(IHashMap hmap,void(*fun)(void*));
+
+/**
+ * Creates an iterator from the elements of an intrusive hash table.
+ *
+ * @see Iterator
+ *
+ * @param hmap the hash table
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator ihashIterator(IHashMap hmap);
+
+#endif
@@ -0,0 +1,216 @@
+/**
+ * Implementation of an intrusive linked list.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ilist.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include "ilist.h"
+
+/**
+ * Given a list (<tt>L</tt>) and an element (<tt>E</tt>), provides the link of
+ * the element.
+ */
+#define LINK(L,E) ((IListLink)((char*)(E)+(L)->offset))
+
+/**
+ * Given a list (<tt>L</tt>) and a link (<tt>K</tt>), provides the element that
+ * contains the link.
+ */
+#define ELEM(L,K) ((void*)((char*)(K)-(L)->offset))
+
+IList newIList(size_t offset)
+{
+  IList list=malloc(sizeof(SIList));
+  if(list)
+  {
+    list->offset=offset;
+    list->size=0;
+    list->first=NULL;
+    list->last=NULL;
+  }
+  return list;
+}
+
+//==============================================================================
+
+void ilistDelete(IList list)
+{
+  free(list);
+}
+
+//==============================================================================
+
+/**
+ * Inserts a link between two links of a list.
+ *
+ * @param list the list
+ * @param prev the previous link (or <tt>NULL</tt>)
+ * @param next the next link (or <tt>NULL</tt>)
+ * @param link the link to be inserted
+ */
+static void ilistLink(IList list,IListLink prev,IListLink next,IListLink link)
+{
+  link->prev=prev;
+  link->next=next;
+  if(prev) prev->next=link;
+  else list->first=link;
+  if(next) next->prev=link;
+  else list->last=link;
+  list->size++;
+}
+
+//==============================================================================
+
+void ilistInsertFst(IList list,void* elem)
+{
+  ilistLink(list,NULL,list->first,LINK(list,elem));
+}
+
+//==============================================================================
+
+void ilistInsertLst(IList list,void* elem)
+{
+  ilistLink(list,list->last,NULL,LINK(list,elem));
+}
+
+//==============================================================================
+
+void ilistInsertBefore(IList list,void* pos,void* elem)
+{
+  IListLink aux=LINK(list,pos);
+  ilistLink(list,aux->prev,aux,LINK(list,elem));
+}
+
+//==============================================================================
+
+void ilistInsertAfter(IList list,void* pos,void* elem)
+{
+  IListLink aux=LINK(list,pos);
+  ilistLink(list,aux,aux->next,LINK(list,elem));
+}
+
+//==============================================================================
+
+void ilistRemove(IList list,void* elem)
+{
+  IListLink aux=LINK(list,elem);
+  if(aux->prev) aux->prev->next=aux->next;
+  else list->first=aux->next;
+  if(aux->next) aux->next->prev=aux->prev;
+  else list->last=aux->prev;
+  aux->prev=NULL;
+  aux->next=NULL;
+  list->size--;
+}
+
+//==============================================================================
+
+int ilistRemoveFst(IList list,void** elem)
+{
+  int result=0;
+  if(!list->size)
+  {
+    if(elem) *elem=NULL;
+    result=1;
+  }
+  else
+  {
+    if(elem) *elem=ELEM(list,list->first);
+    ilistRemove(list,ELEM(list,list->first));
+  }
+  return result;
+}
+
+//==============================================================================
+
+int ilistRemoveLst(IList list,void** elem)
+{
+  int result=0;
+  if(!list->size)
+  {
+    if(elem) *elem=NULL;
+    result=1;
+  }
+  else
+  {
+    if(elem) *elem=ELEM(list,list->last);
+    ilistRemove(list,ELEM(list,list->last));
+  }
+  return result;
+}
+
+//==============================================================================
+
+void* ilistFst(IList list)
+{
+  return list->first?ELEM(list,list->first):NULL;
+}
+
+//==============================================================================
+
+void* ilistLst(IList list)
+{
+  return list->last?ELEM(list,list->last):NULL;
+}
+
+//==============================================================================
+
+void* ilistNext(IList list,void* elem)
+{
+  IListLink aux=LINK(list,elem)->next;
+  return aux?ELEM(list,aux):NULL;
+}
+
+//==============================================================================
+
+void* ilistPrev(IList list,void* elem)
+{
+  IListLink aux=LINK(list,elem)->prev;
+  return aux?ELEM(list,aux):NULL;
+}
+
+//==============================================================================
+
+int ilistSize(IList list)
+{
+  return list->size;
+}
+
+//==============================================================================
+
+int ilistMap(IList list,void(*fun)(void*))
+{
+  int result=0;
+  IListLink aux,next;
+  if(!list->size) result=1;
+  else
+  {
+    for(aux=list->first;aux;aux=next)
+    {
+      next=aux->next;
+      fun(ELEM(list,aux));
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+Iterator ilistIterator(IList list)
+{
+  int ctrl;
+  IListLink aux;
+  Iterator it;
+  it=newIt(list->size);
+  for(aux=list->first,ctrl=!it;aux&&!ctrl;aux=aux->next)
+    ctrl=itAdd(it,ELEM(list,aux));
+  if(ctrl&&it)
+  {
+    itDelete(it);
+    it=NULL;
+  }
+  return it;
+}
@@ -0,0 +1,259 @@
+/**
+ * Implementation of an intrusive linked list.
+ *
+ * Provides functions to create and manipulate a linked list whose links are
+ * embedded in the elements it contains, so that no memory is allocated when
+ * elements are inserted.
+ *
+ * To use this list, the elements must contain a field of type
+ * <tt>@ref SIListLink</tt>, whose offset is provided when the list is created.
+ * An element may contain several links, and thus belong to several lists (or
+ * other intrusive containers) at once.  Each link can only be used by one list
+ * at a time.
+ *
+ * E.g.:
+\code
+typedef struct sOrder
+{
+  int id;
+  SIListLink link;
+}SOrder;
+
+IList list=newIList(offsetof(SOrder,link));
+\endcode
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ilist.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _ILIST_H_
+#define _ILIST_H_
+
+#include <stddef.h>
+#include "iterator.h"
+
+/**
+ * Intrusive linked list link structure.
+ */
+typedef struct sIListLink
+{
+  ///Previous link.
+  struct sIListLink* prev;
+  ///Next link.
+  struct sIListLink* next;
+}SIListLink;
+
+/**
+ * Intrusive linked list link definition.
+ */
+typedef SIListLink* IListLink;
+
+/**
+ * Intrusive linked list structure.
+ */
+typedef struct sIList
+{
+  ///Offset of the link inside the elements.
+  size_t offset;
+  ///Number of elements of this list.
+  int size;
+  ///First link.
+  IListLink first;
+  ///Last link.
+  IListLink last;
+}SIList;
+
+/**
+ * Intrusive linked list definition.
+ */
+typedef SIList* IList;
+
+//==============================================================================
+
+/**
+ * Creates an intrusive list.
+ *
+ * @param offset the offset of the link inside the elements
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new list otherwise
+ */
+IList newIList(size_t offset);
+
+/**
+ * Deletes an intrusive list.
+ *
+ * @attention
+ * This function only frees the memory used by the list.  It does not free the
+ * memory used by elements the list contains.
+ *
+ * @param list the list to be deleted
+ */
+void ilistDelete(IList list);
+
+/**
+ * Inserts an element at the beginning of an intrusive list.
+ *
+ * @param list the list
+ * @param elem the element to be inserted
+ */
+void ilistInsertFst(IList list,void* elem);
+
+/**
+ * Inserts an element at the end of an intrusive list.
+ *
+ * @param list the list
+ * @param elem the element to be inserted
+ */
+void ilistInsertLst(IList list,void* elem);
+
+/**
+ * Inserts an element before another element of an intrusive list.
+ *
+ * @param list the list
+ * @param pos  the element of the list before which the new element is to be
+ * inserted
+ * @param elem the element to be inserted
+ */
+void ilistInsertBefore(IList list,void* pos,void* elem);
+
+/**
+ * Inserts an element after another element of an intrusive list.
+ *
+ * @param list the list
+ * @param pos  the element of the list after which the new element is to be
+ * inserted
+ * @param elem the element to be inserted
+ */
+void ilistInsertAfter(IList list,void* pos,void* elem);
+
+/**
+ * Removes an element from an intrusive list, in constant time.
+ *
+ * @attention
+ * The element must belong to the list.
+ *
+ * @param list the list
+ * @param elem the element to be removed
+ */
+void ilistRemove(IList list,void* elem);
+
+/**
+ * Removes the first element of an intrusive list.
+ *
+ * Provides the removed element if the value of <tt>elem</tt> is not
+ * <tt>NULL</tt>.
+ *
+ * @param list the list
+ * @param elem pointer where the removed element should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the list was empty
+ */
+int ilistRemoveFst(IList list,void** elem);
+
+/**
+ * Removes the last element of an intrusive list.
+ *
+ * Provides the removed element if the value of <tt>elem</tt> is not
+ * <tt>NULL</tt>.
+ *
+ * @param list the list
+ * @param elem pointer where the removed element should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the list was empty
+ */
+int ilistRemoveLst(IList list,void** elem);
+
+/**
+ * Returns the first element of an intrusive list.
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if the list is empty\n
+ * the first element otherwise
+ */
+void* ilistFst(IList list);
+
+/**
+ * Returns the last element of an intrusive list.
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if the list is empty\n
+ * the last element otherwise
+ */
+void* ilistLst(IList list);
+
+/**
+ * Returns the element that follows another element of an intrusive list.
+ *
+ * @param list the list
+ * @param elem the element
+ *
+ * @return
+ * <tt>NULL</tt> if <tt>elem</tt> is the last element\n
+ * the next element otherwise
+ */
+void* ilistNext(IList list,void* elem);
+
+/**
+ * Returns the element that precedes another element of an intrusive list.
+ *
+ * @param list the list
+ * @param elem the element
+ *
+ * @return
+ * <tt>NULL</tt> if <tt>elem</tt> is the first element\n
+ * the previous element otherwise
+ */
+void* ilistPrev(IList list,void* elem);
+
+/**
+ * Returns the size of an intrusive list.
+ *
+ * @param list the list
+ *
+ * @return
+ * the size of the list
+ */
+int ilistSize(IList list);
+
+/**
+ * Applies a function to the elements of an intrusive list.
+ *
+ * The function to be applied must be of type <tt>void fun(void*)</tt>.  It
+ * may remove from the list the element it receives.
+ *
+ * @param list the list
+ * @param fun  the function to be applied
+ *
+ * @return
+ * 0 if the list was not empty\n
+ * 1 otherwise
+ */
+int ilistMap(IList list,void(*fun)(void*));
+
+/**
+ * Creates an iterator from an intrusive list.
+ *
+ * @see Iterator
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator ilistIterator(IList list);
+
+#endif
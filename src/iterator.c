@@ -7,6 +7,7 @@
  * @date 08/2015
  */
 #include <stdlib.h>
+#include <string.h>
 #include "iterator.h"
 
 Iterator newIt(int size)
@@ -73,6 +74,40 @@ int itNext(Iterator it,void** val)
 
 //==============================================================================
 
+int itNextBatch(Iterator it,void** vals,int max)
+{
+  int result=it->size-it->pos;
+  if(result>max) result=max;
+  if(result>0)
+  {
+    memcpy(vals,it->values+it->pos,result*sizeof(void*));
+    it->pos+=result;
+  }
+  else result=0;
+  return result;
+}
+
+//==============================================================================
+
+int itSpan(Iterator it,void*** vals)
+{
+  *vals=it->values+it->pos;
+  return it->size-it->pos;
+}
+
+//==============================================================================
+
+int itSkip(Iterator it,int n)
+{
+  int result=it->size-it->pos;
+  if(result>n) result=n;
+  if(result<0) result=0;
+  it->pos+=result;
+  return result;
+}
+
+//==============================================================================
+
 int itHasNext(Iterator it)
 {
   if((it->pos)<(it->size)) return 1;
@@ -76,6 +76,61 @@ int itAdd(Iterator it,void* val);
  */
 int itNext(Iterator it,void** val);
 
+/**
+ * Provides the next elements of an iterator.
+ *
+ * Copies up to <tt>max</tt> elements, starting at the current position, to
+ * <tt>vals</tt>, and advances the current position accordingly.
+ *
+ * @param it   the iterator
+ * @param vals array where the next elements should be put (with at least
+ * <tt>max</tt> positions)
+ * @param max  the maximum number of elements to be provided
+ *
+ * @return
+ * the number of elements provided
+ */
+int itNextBatch(Iterator it,void** vals,int max);
+
+/**
+ * Provides the remaining elements of an iterator, without copying them.
+ *
+ * Puts at <tt>vals</tt> a pointer to the contiguous array of elements that
+ * starts at the current position.  The current position is not changed (see
+ * <tt>@ref itSkip</tt>).
+ *
+ * E.g.:
+\code
+void** vals;
+int i,n=itSpan(it,&vals);
+for(i=0;i<n;i++) sum+=*(double*)vals[i];
+itSkip(it,n);
+\endcode
+ *
+ * @attention
+ * The elements must not be changed through <tt>vals</tt>.
+ *
+ * @param it   the iterator
+ * @param vals pointer where the address of the remaining elements will be put
+ *
+ * @return
+ * the number of remaining elements
+ */
+int itSpan(Iterator it,void*** vals);
+
+/**
+ * Advances the current position of an iterator.
+ *
+ * The current position is not advanced beyond the end of the iterator.
+ *
+ * @param it the iterator
+ * @param n  the number of positions to advance
+ *
+ * @return
+ * the number of positions advanced
+ */
+int itSkip(Iterator it,int n);
+
 /**
  * Checks if there is "next".
  *
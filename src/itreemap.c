@@ -0,0 +1,438 @@
+/**
+ * Implementation of an intrusive AVL tree (self-balancing binary search tree).
+ *
+ * @author Rui Carlos Gonçalves
+ * @file itreemap.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include "itreemap.h"
+
+/**
+ * Given a tree (<tt>T</tt>) and an element (<tt>E</tt>), provides the link of
+ * the element.
+ */
+#define LINK(T,E) ((ITreeLink)((char*)(E)+(T)->offset))
+
+/**
+ * Given a tree (<tt>T</tt>) and a link (<tt>K</tt>), provides the element that
+ * contains the link.
+ */
+#define ELEM(T,K) ((void*)((char*)(K)-(T)->offset))
+
+/**
+ * Given a tree (<tt>T</tt>) and a link (<tt>K</tt>), provides the key of the
+ * element that contains the link.
+ */
+#define KEY(T,K) ((T)->key(ELEM(T,K)))
+
+/**
+ * Replaces a child of a link (or the root of a tree, if the link is
+ * <tt>NULL</tt>).
+ *
+ * @param tree  the tree
+ * @param super the parent link (or <tt>NULL</tt>)
+ * @param old   the old child
+ * @param new   the new child
+ */
+static void itreeRelink(ITreeMap tree,ITreeLink super,ITreeLink old,
+    ITreeLink new)
+{
+  if(!super) tree->root=new;
+  else if(super->left==old) super->left=new;
+  else super->right=new;
+}
+
+//==============================================================================
+
+/**
+ * Rotates a subtree to left.
+ *
+ * @param tree the tree
+ * @param node the root of the subtree to rotate
+ */
+static void itreeLeftRotate(ITreeMap tree,ITreeLink node)
+{
+  ITreeLink aux=node->right;
+  node->right=aux->left;
+  if(node->right) node->right->super=node;
+  aux->left=node;
+  aux->super=node->super;
+  node->super=aux;
+  itreeRelink(tree,aux->super,node,aux);
+}
+
+//==============================================================================
+
+/**
+ * Rotates a subtree to right.
+ *
+ * @param tree the tree
+ * @param node the root of the subtree to rotate
+ */
+static void itreeRightRotate(ITreeMap tree,ITreeLink node)
+{
+  ITreeLink aux=node->left;
+  node->left=aux->right;
+  if(node->left) node->left->super=node;
+  aux->right=node;
+  aux->super=node->super;
+  node->super=aux;
+  itreeRelink(tree,aux->super,node,aux);
+}
+
+//==============================================================================
+
+/**
+ * Rebalances a subtree whose balance factor is -2 or 2, and updates the balance
+ * factors of the rotated nodes.
+ *
+ * @param tree the tree
+ * @param node the root of the subtree
+ * @param bf   the balance factor of the subtree
+ *
+ * @return
+ * the new root of the subtree
+ */
+static ITreeLink itreeBalance(ITreeMap tree,ITreeLink node,int bf)
+{
+  ITreeLink child,aux;
+  int bc,ba;
+  child=bf>0?node->right:node->left;
+  bc=child->bf;
+  if(bf>0&&bc>=0)
+  {
+    itreeLeftRotate(tree,node);
+    node->bf=bc?0:1;
+    child->bf=bc?0:-1;
+    aux=child;
+  }
+  else if(bf<0&&bc<=0)
+  {
+    itreeRightRotate(tree,node);
+    node->bf=bc?0:-1;
+    child->bf=bc?0:1;
+    aux=child;
+  }
+  else
+  {
+    aux=bf>0?child->left:child->right;
+    ba=aux->bf;
+    if(bf>0)
+    {
+      itreeRightRotate(tree,child);
+      itreeLeftRotate(tree,node);
+    }
+    else
+    {
+      itreeLeftRotate(tree,child);
+      itreeRightRotate(tree,node);
+    }
+    node->bf=ba==bf/2?-ba:0;
+    child->bf=ba==-bf/2?-ba:0;
+    aux->bf=0;
+  }
+  return aux;
+}
+
+//==============================================================================
+
+/**
+ * Updates the balance factors of the ancestors of a subtree whose height
+ * changed, and rebalances the tree if needed.
+ *
+ * @param tree   the tree
+ * @param super  the parent of the subtree
+ * @param dir    change of the balance factor of <tt>super</tt> (-1 or 1)
+ * @param insert specifies whether the height of the subtree increased (as
+ * result of an insertion) or decreased (as result of a remotion)
+ */
+static void itreeRetrace(ITreeMap tree,ITreeLink super,int dir,int insert)
+{
+  int bf,stop;
+  ITreeLink aux;
+  for(stop=0;!stop&&super;)
+  {
+    bf=super->bf+dir;
+    if(bf==-2||bf==2)
+    {
+      aux=itreeBalance(tree,super,bf);
+      stop=insert||aux->bf;
+    }
+    else
+    {
+      super->bf=bf;
+      aux=super;
+      stop=insert?!bf:bf!=0;
+    }
+    if(!stop)
+    {
+      super=aux->super;
+      if(super) dir=(super->left==aux)==insert?-1:1;
+    }
+  }
+}
+
+//==============================================================================
+
+ITreeMap newITree(size_t offset,void*(*key)(void*),
+    int(*keyComp)(void*,void*))
+{
+  ITreeMap tree=NULL;
+  if(key&&keyComp)
+  {
+    tree=malloc(sizeof(SITreeMap));
+    if(tree)
+    {
+      tree->offset=offset;
+      tree->key=*key;
+      tree->keyComp=*keyComp;
+      tree->size=0;
+      tree->root=NULL;
+    }
+  }
+  return tree;
+}
+
+//==============================================================================
+
+void itreeDelete(ITreeMap tree)
+{
+  free(tree);
+}
+
+//==============================================================================
+
+int itreeInsert(ITreeMap tree,void* elem,int replace,void** old)
+{
+  int sig=0,result=0;
+  void* key=tree->key(elem);
+  ITreeLink aux,super,link=LINK(tree,elem);
+  for(super=NULL,aux=tree->root;aux&&(sig=tree->keyComp(key,KEY(tree,aux)));
+      super=aux,aux=sig<0?aux->left:aux->right);
+  if(aux)
+  {
+    if(old) *old=ELEM(tree,aux);
+    if(replace&&link!=aux)
+    {
+      *link=*aux;
+      if(link->left) link->left->super=link;
+      if(link->right) link->right->super=link;
+      itreeRelink(tree,link->super,aux,link);
+      aux->super=NULL;
+      aux->left=NULL;
+      aux->right=NULL;
+    }
+    result=1;
+  }
+  else
+  {
+    if(old) *old=NULL;
+    link->super=super;
+    link->left=NULL;
+    link->right=NULL;
+    link->bf=0;
+    if(!super) tree->root=link;
+    else if(sig<0) super->left=link;
+    else super->right=link;
+    itreeRetrace(tree,super,sig<0?-1:1,1);
+    tree->size++;
+  }
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Removes a link from a tree, and rebalances the tree.
+ *
+ * @param tree the tree
+ * @param link the link to be removed
+ */
+static void itreeUnlink(ITreeMap tree,ITreeLink link)
+{
+  int dir;
+  ITreeLink aux,child,super;
+  if(!link->left||!link->right)
+  {
+    child=link->left?link->left:link->right;
+    super=link->super;
+    dir=super&&super->left==link?1:-1;
+    itreeRelink(tree,super,link,child);
+    if(child) child->super=super;
+  }
+  else
+  {
+    for(aux=link->right;aux->left;aux=aux->left);
+    if(aux==link->right)
+    {
+      super=aux;
+      dir=-1;
+    }
+    else
+    {
+      super=aux->super;
+      dir=1;
+      super->left=aux->right;
+      if(aux->right) aux->right->super=super;
+      aux->right=link->right;
+      aux->right->super=aux;
+    }
+    aux->left=link->left;
+    aux->left->super=aux;
+    aux->super=link->super;
+    aux->bf=link->bf;
+    itreeRelink(tree,link->super,link,aux);
+  }
+  link->super=NULL;
+  link->left=NULL;
+  link->right=NULL;
+  itreeRetrace(tree,super,dir,0);
+  tree->size--;
+}
+
+//==============================================================================
+
+int itreeRemove(ITreeMap tree,void* key,void** elem)
+{
+  int sig=0,result=0;
+  ITreeLink aux;
+  for(aux=tree->root;aux&&(sig=tree->keyComp(key,KEY(tree,aux)));
+      aux=sig<0?aux->left:aux->right);
+  if(!aux)
+  {
+    if(elem) *elem=NULL;
+    result=1;
+  }
+  else
+  {
+    if(elem) *elem=ELEM(tree,aux);
+    itreeUnlink(tree,aux);
+  }
+  return result;
+}
+
+//==============================================================================
+
+void itreeRemoveElem(ITreeMap tree,void* elem)
+{
+  itreeUnlink(tree,LINK(tree,elem));
+}
+
+//==============================================================================
+
+int itreeGet(ITreeMap tree,void* key,void** elem)
+{
+  int sig=0,result=0;
+  ITreeLink aux;
+  for(aux=tree->root;aux&&(sig=tree->keyComp(key,KEY(tree,aux)));
+      aux=sig<0?aux->left:aux->right);
+  if(!aux)
+  {
+    *elem=NULL;
+    result=1;
+  }
+  else *elem=ELEM(tree,aux);
+  return result;
+}
+
+//==============================================================================
+
+void* itreeFst(ITreeMap tree)
+{
+  ITreeLink aux=tree->root;
+  if(aux) for(;aux->left;aux=aux->left);
+  return aux?ELEM(tree,aux):NULL;
+}
+
+//==============================================================================
+
+void* itreeLst(ITreeMap tree)
+{
+  ITreeLink aux=tree->root;
+  if(aux) for(;aux->right;aux=aux->right);
+  return aux?ELEM(tree,aux):NULL;
+}
+
+//==============================================================================
+
+void* itreeNext(ITreeMap tree,void* elem)
+{
+  ITreeLink aux=LINK(tree,elem);
+  if(aux->right) for(aux=aux->right;aux->left;aux=aux->left);
+  else
+  {
+    for(;aux->super&&aux==aux->super->right;aux=aux->super);
+    aux=aux->super;
+  }
+  return aux?ELEM(tree,aux):NULL;
+}
+
+//==============================================================================
+
+void* itreePrev(ITreeMap tree,void* elem)
+{
+  ITreeLink aux=LINK(tree,elem);
+  if(aux->left) for(aux=aux->left;aux->right;aux=aux->right);
+  else
+  {
+    for(;aux->super&&aux==aux->super->left;aux=aux->super);
+    aux=aux->super;
+  }
+  return aux?ELEM(tree,aux):NULL;
+}
+
+//==============================================================================
+
+int itreeSize(ITreeMap tree)
+{
+  return tree->size;
+}
+
+//==============================================================================
+
+/**
+ * Inorder traversal auxiliary function.
+ *
+ * @param tree the tree
+ * @param link the root of the subtree
+ * @param fun  the function to be applied
+ */
+static void itreeInOAux(ITreeMap tree,ITreeLink link,void(*fun)(void*))
+{
+  if(link)
+  {
+    itreeInOAux(tree,link->left,fun);
+    fun(ELEM(tree,link));
+    itreeInOAux(tree,link->right,fun);
+  }
+}
+
+//==============================================================================
+
+int itreeInOrder(ITreeMap tree,void(*fun)(void*))
+{
+  int result=0;
+  if(!tree->size) result=1;
+  else itreeInOAux(tree,tree->root,fun);
+  return result;
+}
+
+//==============================================================================
+
+Iterator itreeIterator(ITreeMap tree)
+{
+  int ctrl;
+  void* aux;
+  Iterator it;
+  it=newIt(tree->size);
+  for(aux=itreeFst(tree),ctrl=!it;aux&&!ctrl;aux=itreeNext(tree,aux))
+    ctrl=itAdd(it,aux);
+  if(ctrl&&it)
+  {
+    itDelete(it);
+    it=NULL;
+  }
+  return it;
+}
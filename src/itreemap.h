@@ -0,0 +1,269 @@
+/**
+ * Implementation of an intrusive AVL tree (self-balancing binary search tree).
+ *
+ * Provides functions to create and manipulate an AVL tree whose links are
+ * embedded in the elements it contains, so that no memory is allocated when
+ * elements are inserted.
+ *
+ * To use this tree, the elements must contain a field of type
+ * <tt>@ref SITreeLink</tt>, whose offset is provided when the tree is created.
+ * An element may contain several links, and thus belong to several trees (or
+ * other intrusive containers) at once.
+ *
+ * Besides the key comparison function described in <tt>treemap.h</tt>, a
+ * function <tt>void* key(void* elem)</tt>, which provides the key of an
+ * element, must be provided.
+ *
+ * E.g.:
+\code
+typedef struct sOrder
+{
+  char* id;
+  double price;
+  SITreeLink byPrice;
+  SIHashLink byId;
+  SIListLink byTime;
+}SOrder;
+
+void* orderPrice(void* order)
+{
+  return &((SOrder*)order)->price;
+}
+
+ITreeMap tree=newITree(offsetof(SOrder,byPrice),orderPrice,priceComp);
+\endcode
+ *
+ * @author Rui Carlos Gonçalves
+ * @file itreemap.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _ITREEMAP_H_
+#define _ITREEMAP_H_
+
+#include <stddef.h>
+#include "iterator.h"
+
+/**
+ * Intrusive tree link structure.
+ */
+typedef struct sITreeLink
+{
+  ///Node's parent.
+  struct sITreeLink* super;
+  ///Node's left subtree.
+  struct sITreeLink* left;
+  ///Node's right subtree.
+  struct sITreeLink* right;
+  ///Node's balance factor (-1, 0, or 1).
+  int bf;
+}SITreeLink;
+
+/**
+ * Intrusive tree link definition.
+ */
+typedef SITreeLink* ITreeLink;
+
+/**
+ * Intrusive tree structure.
+ */
+typedef struct sITreeMap
+{
+  ///Offset of the link inside the elements.
+  size_t offset;
+  ///Function that provides the key of an element.
+  void*(*key)(void*);
+  ///Key comparison function of this tree.
+  int(*keyComp)(void*,void*);
+  ///Number of elements of this tree.
+  int size;
+  ///Root link of this tree.
+  ITreeLink root;
+}SITreeMap;
+
+/**
+ * Intrusive tree definition.
+ */
+typedef SITreeMap* ITreeMap;
+
+//==============================================================================
+
+/**
+ * Creates an intrusive tree.
+ *
+ * @param offset  the offset of the link inside the elements
+ * @param key     the function that provides the key of an element
+ * @param keyComp the comparison function
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new tree otherwise
+ */
+ITreeMap newITree(size_t offset,void*(*key)(void*)
+                 ,int(*keyComp)(void*,void*));
+
+/**
+ * Deletes an intrusive tree.
+ *
+ * @attention
+ * This function only free the memory used by the tree.  It does not free the
+ * memory used by elements the tree contains.
+ *
+ * @param tree the tree to be deleted
+ */
+void itreeDelete(ITreeMap tree);
+
+/**
+ * Inserts an element in an intrusive tree.
+ *
+ * If there was already an element with the same key, the <tt>replace</tt>
+ * argument specifies whether the new element should replace it (it will
+ * replace it only if <tt>replace!=0</tt>).  The element that was already in
+ * the tree is provided if the value of <tt>old</tt> is not <tt>NULL</tt>.
+ *
+ * @param tree    the tree
+ * @param elem    the element to be inserted
+ * @param replace specifies whether an old element shall be replaced
+ * @param old     pointer where the element with the same key shall be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was inserted\n
+ * 1 if there was already an element with the same key
+ */
+int itreeInsert(ITreeMap tree,void* elem,int replace,void** old);
+
+/**
+ * Removes the element with the specified key from an intrusive tree.
+ *
+ * Provides the removed element if the value of <tt>elem</tt> is not
+ * <tt>NULL</tt>.
+ *
+ * @param tree the tree
+ * @param key  key whose element is to be removed
+ * @param elem pointer where the removed element shall be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 otherwise
+ */
+int itreeRemove(ITreeMap tree,void* key,void** elem);
+
+/**
+ * Removes an element from an intrusive tree.
+ *
+ * Unlike <tt>@ref itreeRemove</tt>, the element to be removed is identified by
+ * its address, and thus key comparisons are not needed.
+ *
+ * @attention
+ * The element must belong to the tree.
+ *
+ * @param tree the tree
+ * @param elem the element to be removed
+ */
+void itreeRemoveElem(ITreeMap tree,void* elem);
+
+/**
+ * Provides the element with the specified key from an intrusive tree.
+ *
+ * If there is no element with the specified key, it will be put the value
+ * <tt>NULL</tt> at <tt>elem</tt>.
+ *
+ * @param tree the tree
+ * @param key  key whose element is to be provided
+ * @param elem pointer where the element will be put
+ *
+ * @return
+ * 0 if there was an element with the specified key\n
+ * 1 otherwise
+ */
+int itreeGet(ITreeMap tree,void* key,void** elem);
+
+/**
+ * Returns the element with the smallest key of an intrusive tree.
+ *
+ * @param tree the tree
+ *
+ * @return
+ * <tt>NULL</tt> if the tree is empty\n
+ * the element with the smallest key otherwise
+ */
+void* itreeFst(ITreeMap tree);
+
+/**
+ * Returns the element with the greatest key of an intrusive tree.
+ *
+ * @param tree the tree
+ *
+ * @return
+ * <tt>NULL</tt> if the tree is empty\n
+ * the element with the greatest key otherwise
+ */
+void* itreeLst(ITreeMap tree);
+
+/**
+ * Returns the element that follows another element of an intrusive tree (in
+ * key order).
+ *
+ * @param tree the tree
+ * @param elem the element
+ *
+ * @return
+ * <tt>NULL</tt> if <tt>elem</tt> has the greatest key\n
+ * the next element otherwise
+ */
+void* itreeNext(ITreeMap tree,void* elem);
+
+/**
+ * Returns the element that precedes another element of an intrusive tree (in
+ * key order).
+ *
+ * @param tree the tree
+ * @param elem the element
+ *
+ * @return
+ * <tt>NULL</tt> if <tt>elem</tt> has the smallest key\n
+ * the previous element otherwise
+ */
+void* itreePrev(ITreeMap tree,void* elem);
+
+/**
+ * Returns the number of elements present in an intrusive tree.
+ *
+ * @param tree the tree
+ *
+ * @return
+ * the number of elements present in the tree
+ */
+int itreeSize(ITreeMap tree);
+
+/**
+ * Applies a function to the elements of an intrusive tree (inorder
+ * traversal).
+ *
+ * The function to be applied must be of type <tt>void fun(void*)</tt>.
+ *
+ * @param tree the tree
+ * @param fun  the function to be applied
+ *
+ * @return
+ * 0 if the tree was not empty\n
+ * 1 otherwise
+ */
+int itreeInOrder(ITreeMap tree,void(*fun)(void*));
+
+/**
+ * Creates an iterator from the elements of an intrusive tree (in key order).
+ *
+ * @see Iterator
+ *
+ * @param tree the tree
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator itreeIterator(ITreeMap tree);
+
+#endif
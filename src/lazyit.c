@@ -0,0 +1,396 @@
+/**
+ * Implementation of a lazy iterator.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file lazyit.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include "lazyit.h"
+
+LazyIt newLazy(int(*next)(LazyIt,void**),void(*del)(LazyIt))
+{
+  int i;
+  LazyIt it=NULL;
+  if(next)
+  {
+    it=malloc(sizeof(SLazyIt));
+    if(it)
+    {
+      it->next=*next;
+      it->del=del;
+      for(i=0;i<4;i++) it->state[i]=NULL;
+      it->fun=NULL;
+      for(i=0;i<4;i++) it->index[i]=0;
+    }
+  }
+  return it;
+}
+
+//==============================================================================
+
+void lazyDelete(LazyIt it)
+{
+  if(it->del) it->del(it);
+  free(it);
+}
+
+//==============================================================================
+
+int lazyNext(LazyIt it,void** val)
+{
+  int result=it->next(it,val);
+  if(result) *val=NULL;
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator over an iterator.
+ *
+ * The state of the iterator holds the iterator, the next position, and the
+ * position where the iteration stops.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int itLazyNext(LazyIt it,void** val)
+{
+  int result=1;
+  if(it->index[0]<it->index[1])
+  {
+    result=itAt(it->state[0],it->index[0],val);
+    if(!result) it->index[0]++;
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt itLazy(Iterator it)
+{
+  LazyIt lazy=newLazy(itLazyNext,NULL);
+  if(lazy)
+  {
+    lazy->state[0]=it;
+    lazy->index[0]=itGetPos(it);
+    lazy->index[1]=it->size;
+  }
+  return lazy;
+}
+
+//==============================================================================
+
+int itSplit(Iterator it,int n,LazyIt* parts)
+{
+  int i,size,result;
+  size=it->size-it->pos;
+  result=n<1?-1:size<n?size:n;
+  for(i=0;i<result&&(parts[i]=newLazy(itLazyNext,NULL));i++)
+  {
+    parts[i]->state[0]=it;
+    parts[i]->index[0]=it->pos+(int)((long)size*i/result);
+    parts[i]->index[1]=it->pos+(int)((long)size*(i+1)/result);
+  }
+  if(i<result)
+  {
+    while(i>0) lazyDelete(parts[--i]);
+    result=-1;
+  }
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Deletes the source iterators of a composed lazy iterator.
+ *
+ * @param it the lazy iterator
+ */
+static void lazyDelSources(LazyIt it)
+{
+  int i;
+  for(i=0;i<4;i++) if(it->state[i]) lazyDelete(it->state[i]);
+}
+
+//==============================================================================
+
+/**
+ * Creates a lazy iterator composed from one or two source iterators, taking
+ * ownership of them.
+ *
+ * If a source iterator is <tt>NULL</tt>, or the new iterator cannot be created,
+ * the source iterators are deleted.
+ *
+ * @param next the function that computes the next element
+ * @param n    the number of source iterators (1 or 2)
+ * @param it1  the first source iterator
+ * @param it2  the second source iterator (ignored if <tt>n</tt> is 1)
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new iterator otherwise
+ */
+static LazyIt lazyCompose(int(*next)(LazyIt,void**),int n,LazyIt it1,
+    LazyIt it2)
+{
+  LazyIt new=NULL;
+  if(n<2) it2=NULL;
+  if(it1&&(n<2||it2)) new=newLazy(next,lazyDelSources);
+  if(new)
+  {
+    new->state[0]=it1;
+    new->state[1]=it2;
+  }
+  else
+  {
+    if(it1) lazyDelete(it1);
+    if(it2) lazyDelete(it2);
+  }
+  return new;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator created by
+ * <tt>@ref lazyFilter</tt>.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int lazyFilterNext(LazyIt it,void** val)
+{
+  int result,stop;
+  int(*pred)(void*)=(int(*)(void*))it->fun;
+  for(stop=0;!stop;)
+  {
+    result=lazyNext(it->state[0],val);
+    stop=result||pred(*val);
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt lazyFilter(LazyIt it,int(*pred)(void*))
+{
+  LazyIt new=lazyCompose(lazyFilterNext,1,it,NULL);
+  if(new) new->fun=(void(*)(void))pred;
+  return new;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator created by
+ * <tt>@ref lazyMap</tt>.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int lazyMapNext(LazyIt it,void** val)
+{
+  int result=lazyNext(it->state[0],val);
+  if(!result) *val=((void*(*)(void*))it->fun)(*val);
+  return result;
+}
+
+//==============================================================================
+
+LazyIt lazyMap(LazyIt it,void*(*fun)(void*))
+{
+  LazyIt new=lazyCompose(lazyMapNext,1,it,NULL);
+  if(new) new->fun=(void(*)(void))fun;
+  return new;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator created by
+ * <tt>@ref lazyTake</tt>.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int lazyTakeNext(LazyIt it,void** val)
+{
+  int result=1;
+  if(it->index[0]>0)
+  {
+    result=lazyNext(it->state[0],val);
+    it->index[0]=result?0:it->index[0]-1;
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt lazyTake(LazyIt it,int n)
+{
+  LazyIt new=lazyCompose(lazyTakeNext,1,it,NULL);
+  if(new) new->index[0]=n;
+  return new;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator created by
+ * <tt>@ref lazySkip</tt>.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int lazySkipNext(LazyIt it,void** val)
+{
+  int result=0;
+  for(;it->index[0]>0&&!result;it->index[0]--)
+    result=lazyNext(it->state[0],val);
+  if(!result) result=lazyNext(it->state[0],val);
+  return result;
+}
+
+//==============================================================================
+
+LazyIt lazySkip(LazyIt it,int n)
+{
+  LazyIt new=lazyCompose(lazySkipNext,1,it,NULL);
+  if(new) new->index[0]=n;
+  return new;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator created by
+ * <tt>@ref lazyZip</tt>.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int lazyZipNext(LazyIt it,void** val)
+{
+  int result;
+  void* aux;
+  result=lazyNext(it->state[0],&aux)||lazyNext(it->state[1],val);
+  if(!result) *val=((void*(*)(void*,void*))it->fun)(aux,*val);
+  return result;
+}
+
+//==============================================================================
+
+LazyIt lazyZip(LazyIt it1,LazyIt it2,void*(*fun)(void*,void*))
+{
+  LazyIt new=lazyCompose(lazyZipNext,2,it1,it2);
+  if(new) new->fun=(void(*)(void))fun;
+  return new;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator created by
+ * <tt>@ref lazyChain</tt>.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int lazyChainNext(LazyIt it,void** val)
+{
+  int result=lazyNext(it->state[it->index[0]],val);
+  if(result&&!it->index[0])
+  {
+    it->index[0]=1;
+    result=lazyNext(it->state[1],val);
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt lazyChain(LazyIt it1,LazyIt it2)
+{
+  LazyIt new=lazyCompose(lazyChainNext,2,it1,it2);
+  return new;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator created by
+ * <tt>@ref lazyFlatMap</tt>.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int lazyFlatMapNext(LazyIt it,void** val)
+{
+  int result=1,stop;
+  void* aux;
+  for(stop=0;!stop;)
+  {
+    if(it->state[1]&&!(result=lazyNext(it->state[1],val))) stop=1;
+    else
+    {
+      if(it->state[1]) lazyDelete(it->state[1]);
+      it->state[1]=NULL;
+      if(lazyNext(it->state[0],&aux)) stop=1;
+      else it->state[1]=((LazyIt(*)(void*))it->fun)(aux);
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt lazyFlatMap(LazyIt it,LazyIt(*fun)(void*))
+{
+  LazyIt new=lazyCompose(lazyFlatMapNext,1,it,NULL);
+  if(new) new->fun=(void(*)(void))fun;
+  return new;
+}
+
+//==============================================================================
+
+void* lazyReduce(LazyIt it,void* init,void*(*fun)(void*,void*))
+{
+  void* val;
+  while(!lazyNext(it,&val)) init=fun(init,val);
+  return init;
+}
@@ -0,0 +1,296 @@
+/**
+ * Implementation of a lazy iterator.
+ *
+ * Unlike <tt>@ref Iterator</tt>, which contains a copy of the sequence of
+ * elements to be iterated, lazy iterators provide the elements on demand, using
+ * a function that computes the next element from a small state block.
+ * Therefore, creating a lazy iterator takes constant time and memory,
+ * regardless of the size of the container.
+ *
+ * Lazy iterators over containers are provided by the modules of the containers
+ * (e.g. <tt>@ref listLazy</tt>, or <tt>@ref treeLazyKeys</tt>).
+ *
+ * Lazy iterators can be composed (e.g. using <tt>@ref lazyFilter</tt>, or
+ * <tt>@ref lazyMap</tt>) into pipelines that process the elements in a single
+ * pass, without intermediate containers.  The iterator created by a composition
+ * function takes ownership of the iterators it receives: deleting it also
+ * deletes them.  If the composition function fails, or receives a
+ * <tt>NULL</tt> iterator, it deletes the iterators it receives and returns
+ * <tt>NULL</tt>.
+ *
+ * E.g. (sum of the squares of the first 10 even values of a list):
+\code
+void* sum=(void*)0;
+LazyIt it=listLazy(list);
+if(it) it=lazyFilter(it,isEven);
+if(it) it=lazyMap(it,square);
+if(it) it=lazyTake(it,10);
+if(it)
+{
+  sum=lazyReduce(it,sum,add);
+  lazyDelete(it);
+}
+\endcode
+ *
+ * @attention
+ * A lazy iterator over a container becomes invalid when elements are inserted
+ * in or removed from the container.
+ *
+ * Some containers can also be split into several lazy iterators over disjoint
+ * parts of the container (e.g. <tt>@ref itSplit</tt>, or
+ * <tt>@ref treeSplitKeys</tt>), so that each part can be consumed by a
+ * different thread.  Lazy iterators over the same container can be used
+ * concurrently, as long as the container is not modified.
+ *
+ * New kinds of lazy iterators can be defined by providing a function of type
+ * <tt>int next(LazyIt it,void** val)</tt>, which puts the next element at
+ * <tt>val</tt> and returns 0 (or returns 1 when there are no more elements),
+ * and optionally a function of type <tt>void del(LazyIt it)</tt>, which frees
+ * the resources referred by the state of the iterator.
+ *
+ * E.g. (iterator over the integers from 0 to 9):
+\code
+int upTo10(LazyIt it,void** val)
+{
+  int result=0;
+  if(it->index[0]>=10) result=1;
+  else *val=(void*)(long)it->index[0]++;
+  return result;
+}
+
+LazyIt it=newLazy(upTo10,NULL);
+\endcode
+ *
+ * @author Rui Carlos Gonçalves
+ * @file lazyit.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _LAZYIT_H_
+#define _LAZYIT_H_
+
+#include "iterator.h"
+
+/**
+ * Lazy iterator structure.
+ */
+typedef struct sLazyIt
+{
+  ///Function that provides the next element.
+  int(*next)(struct sLazyIt*,void**);
+  ///Function that frees the resources referred by the state (or
+  ///<tt>NULL</tt>).
+  void(*del)(struct sLazyIt*);
+  ///State of this iterator (container, current node, etc.).
+  void* state[4];
+  ///Function used to compute the elements (e.g. by <tt>@ref lazyMap</tt>).
+  void(*fun)(void);
+  ///Numeric state of this iterator (position, bucket, etc.).
+  int index[4];
+}SLazyIt;
+
+/**
+ * Lazy iterator definition.
+ */
+typedef SLazyIt* LazyIt;
+
+//==============================================================================
+
+/**
+ * Creates a lazy iterator.
+ *
+ * The state of the new iterator is initialized with zeros.
+ *
+ * @param next the function that provides the next element
+ * @param del  the function that frees the resources referred by the state (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new iterator otherwise
+ */
+LazyIt newLazy(int(*next)(LazyIt,void**),void(*del)(LazyIt));
+
+/**
+ * Deletes a lazy iterator.
+ *
+ * @param it the iterator to be deleted
+ */
+void lazyDelete(LazyIt it);
+
+/**
+ * Provides the next element of a lazy iterator.
+ *
+ * @param it  the iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+int lazyNext(LazyIt it,void** val);
+
+/**
+ * Creates a lazy iterator from the elements of an iterator, starting at its
+ * current position.
+ *
+ * The lazy iterator does not change the position of <tt>it</tt>, and it does
+ * not take ownership of it (<tt>it</tt> must be deleted after the lazy
+ * iterator).
+ *
+ * @param it the iterator
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt itLazy(Iterator it);
+
+/**
+ * Splits the remaining elements of an iterator into disjoint lazy iterators,
+ * which can be consumed concurrently.
+ *
+ * The elements from the current position of <tt>it</tt> onwards are split into
+ * at most <tt>n</tt> contiguous parts of similar size (fewer parts are created
+ * if there are fewer elements than <tt>n</tt>).  The position of <tt>it</tt> is
+ * not changed.  As in <tt>@ref itLazy</tt>, <tt>it</tt> must be deleted after
+ * the lazy iterators.
+ *
+ * @param it    the iterator
+ * @param n     the maximum number of parts (a positive number)
+ * @param parts array where the lazy iterators will be put (with at least
+ * <tt>n</tt> positions)
+ *
+ * @return
+ * -1 if an error occurred, or <tt>n</tt> was not positive (no lazy iterator is
+ * created)\n
+ * the number of lazy iterators created otherwise
+ */
+int itSplit(Iterator it,int n,LazyIt* parts);
+
+/**
+ * Creates a lazy iterator that provides the elements of another lazy iterator
+ * that satisfy a predicate.
+ *
+ * The predicate must be of type <tt>int pred(void*)</tt>, and it must return a
+ * value different from 0 for the elements to be provided.
+ *
+ * @param it   the source iterator
+ * @param pred the predicate
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new iterator otherwise
+ */
+LazyIt lazyFilter(LazyIt it,int(*pred)(void*));
+
+/**
+ * Creates a lazy iterator that provides the result of applying a function to
+ * the elements of another lazy iterator.
+ *
+ * The function to be applied must be of type <tt>void* fun(void*)</tt>.
+ *
+ * @param it  the source iterator
+ * @param fun the function to be applied
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new iterator otherwise
+ */
+LazyIt lazyMap(LazyIt it,void*(*fun)(void*));
+
+/**
+ * Creates a lazy iterator that provides (at most) the first <tt>n</tt>
+ * elements of another lazy iterator.
+ *
+ * @param it the source iterator
+ * @param n  the number of elements
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new iterator otherwise
+ */
+LazyIt lazyTake(LazyIt it,int n);
+
+/**
+ * Creates a lazy iterator that provides the elements of another lazy iterator,
+ * except the first <tt>n</tt>.
+ *
+ * @param it the source iterator
+ * @param n  the number of elements to skip
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new iterator otherwise
+ */
+LazyIt lazySkip(LazyIt it,int n);
+
+/**
+ * Creates a lazy iterator that combines the elements of two lazy iterators,
+ * pairwise.
+ *
+ * The function used to combine the elements must be of type
+ * <tt>void* fun(void*,void*)</tt>.  The new iterator ends when any of the
+ * source iterators ends.
+ *
+ * @param it1 the first source iterator
+ * @param it2 the second source iterator
+ * @param fun the function used to combine the elements
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new iterator otherwise
+ */
+LazyIt lazyZip(LazyIt it1,LazyIt it2,void*(*fun)(void*,void*));
+
+/**
+ * Creates a lazy iterator that provides the elements of a lazy iterator,
+ * followed by the elements of another lazy iterator.
+ *
+ * @param it1 the first source iterator
+ * @param it2 the second source iterator
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new iterator otherwise
+ */
+LazyIt lazyChain(LazyIt it1,LazyIt it2);
+
+/**
+ * Creates a lazy iterator that provides the elements of the lazy iterators
+ * obtained by applying a function to the elements of another lazy iterator.
+ *
+ * The function to be applied must be of type <tt>LazyIt fun(void*)</tt>.  The
+ * iterators it returns are deleted once they end.  If it returns
+ * <tt>NULL</tt>, the corresponding element is ignored.
+ *
+ * @param it  the source iterator
+ * @param fun the function to be applied
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new iterator otherwise
+ */
+LazyIt lazyFlatMap(LazyIt it,LazyIt(*fun)(void*));
+
+/**
+ * Reduces the remaining elements of a lazy iterator to a single value.
+ *
+ * The function used to reduce the elements must be of type
+ * <tt>void* fun(void* acc,void* val)</tt>.  It is applied to <tt>init</tt> and
+ * to the first element, then to the result and to the second element, and so
+ * on.
+ *
+ * @attention
+ * This function does not delete the iterator.
+ *
+ * @param it   the iterator
+ * @param init the initial value
+ * @param fun  the function used to reduce the elements
+ *
+ * @return
+ * the result of the reduction
+ */
+void* lazyReduce(LazyIt it,void* init,void*(*fun)(void*,void*));
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * Implementation of a lock-free stack.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file lfstack.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include "lfstack.h"
+
+/**
+ * Position that represents the end of a list of nodes.
+ */
+#define NIL UINT32_MAX
+
+/**
+ * Given a top (<tt>T</tt>), provides the position of its node.
+ */
+#define NODE(T) ((uint32_t)(T))
+
+/**
+ * Given a top (<tt>T</tt>) and a position (<tt>I</tt>), provides the next top,
+ * which refers the position and has the counter incremented.
+ */
+#define NEXT(T,I) ((((T)>>32)+1)<<32|(uint64_t)(I))
+
+LFStack newLFStack(int capacity)
+{
+  int i;
+  LFStack stack=NULL;
+  if(capacity>0)
+  {
+    stack=aligned_alloc(LFSTACK_LINE,sizeof(SLFStack));
+    if(stack)
+    {
+      stack->nodes=malloc(capacity*sizeof(SLFStackNode));
+      if(!stack->nodes)
+      {
+        free(stack);
+        stack=NULL;
+      }
+      else
+      {
+        for(i=0;i<capacity;i++)
+        {
+          atomic_init(&stack->nodes[i].next,i+1<capacity?(uint32_t)i+1:NIL);
+          stack->nodes[i].value=NULL;
+        }
+        atomic_init(&stack->top,NIL);
+        atomic_init(&stack->unused,0);
+        atomic_init(&stack->size,0);
+        stack->capacity=capacity;
+      }
+    }
+  }
+  return stack;
+}
+
+//==============================================================================
+
+void lfstackDelete(LFStack stack)
+{
+  free(stack->nodes);
+  free(stack);
+}
+
+//==============================================================================
+
+/**
+ * Removes the node at the top of a list of nodes of a lock-free stack.
+ *
+ * @param stack the stack
+ * @param top   the top of the list
+ *
+ * @return
+ * <tt>NIL</tt> if the list was empty\n
+ * the position of the removed node otherwise
+ */
+static uint32_t lfstackTake(LFStack stack,_Atomic(uint64_t)* top)
+{
+  int done=0;
+  uint32_t next,node=NIL;
+  uint64_t cur=atomic_load_explicit(top,memory_order_acquire);
+  while(!done)
+  {
+    node=NODE(cur);
+    if(node==NIL) done=1;
+    else
+    {
+      next=atomic_load_explicit(&stack->nodes[node].next,memory_order_relaxed);
+      done=atomic_compare_exchange_weak_explicit(top,&cur,NEXT(cur,next),
+                                                 memory_order_acquire,
+                                                 memory_order_acquire);
+    }
+  }
+  return node;
+}
+
+//==============================================================================
+
+/**
+ * Puts a node at the top of a list of nodes of a lock-free stack.
+ *
+ * @param stack the stack
+ * @param top   the top of the list
+ * @param node  the position of the node
+ */
+static void lfstackPut(LFStack stack,_Atomic(uint64_t)* top,uint32_t node)
+{
+  int done=0;
+  uint64_t cur=atomic_load_explicit(top,memory_order_relaxed);
+  while(!done)
+  {
+    atomic_store_explicit(&stack->nodes[node].next,NODE(cur),
+                          memory_order_relaxed);
+    done=atomic_compare_exchange_weak_explicit(top,&cur,NEXT(cur,node),
+                                               memory_order_release,
+                                               memory_order_relaxed);
+  }
+}
+
+//==============================================================================
+
+int lfstackPush(LFStack stack,void* value)
+{
+  int result=0;
+  uint32_t node=lfstackTake(stack,&stack->unused);
+  if(node==NIL) result=1;
+  else
+  {
+    stack->nodes[node].value=value;
+    lfstackPut(stack,&stack->top,node);
+    atomic_fetch_add_explicit(&stack->size,1,memory_order_relaxed);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int lfstackPop(LFStack stack,void** value)
+{
+  int result=0;
+  void* aux=NULL;
+  uint32_t node=lfstackTake(stack,&stack->top);
+  if(node==NIL) result=1;
+  else
+  {
+    aux=stack->nodes[node].value;
+    lfstackPut(stack,&stack->unused,node);
+    atomic_fetch_sub_explicit(&stack->size,1,memory_order_relaxed);
+  }
+  if(value) *value=aux;
+  return result;
+}
+
+//==============================================================================
+
+int lfstackSize(LFStack stack)
+{
+  int size=atomic_load_explicit(&stack->size,memory_order_relaxed);
+  return size<0?0:size>stack->capacity?stack->capacity:size;
+}
+
+//==============================================================================
+
+int lfstackCapacity(LFStack stack)
+{
+  return stack->capacity;
+}
@@ -0,0 +1,143 @@
+/**
+ * Implementation of a lock-free stack.
+ *
+ * Provides functions to create and manipulate a bounded stack that can be used
+ * by any number of threads at the same time, without locks.
+ *
+ * The stack is a Treiber stack: the elements are stored in a linked list, and
+ * the top of the list is replaced using a compare-and-swap.  The nodes of the
+ * list are taken from a pool allocated when the stack is created, and unused
+ * nodes are kept in a second stack of the same kind, so that pushing and
+ * popping never allocate memory.  Nodes are referred by their position in the
+ * pool, and each top is stored together with a counter that is incremented by
+ * every change, which prevents a stale compare-and-swap from succeeding when a
+ * node is popped and pushed again in the meantime (the ABA problem).
+ *
+ * Requires C11 atomics (<tt>stdatomic.h</tt>), and is only lock-free where
+ * 64-bit atomic operations are.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file lfstack.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _LFSTACK_H_
+#define _LFSTACK_H_
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+/**
+ * Size of a cache line (in bytes).
+ */
+#define LFSTACK_LINE 64
+
+/**
+ * Lock-free stack node structure.
+ */
+typedef struct sLFStackNode
+{
+  ///Position of the next node in the pool (or <tt>UINT32_MAX</tt>).
+  _Atomic(uint32_t) next;
+  ///Node's value.
+  void* value;
+}SLFStackNode;
+
+/**
+ * Lock-free stack structure.
+ */
+typedef struct sLFStack
+{
+  ///Top of this stack (counter in the high 32 bits, position in the low ones).
+  _Alignas(LFSTACK_LINE) _Atomic(uint64_t) top;
+  ///Top of the list of unused nodes of this stack.
+  _Alignas(LFSTACK_LINE) _Atomic(uint64_t) unused;
+  ///Approximate number of elements of this stack.
+  _Alignas(LFSTACK_LINE) atomic_int size;
+  ///Capacity of this stack.
+  _Alignas(LFSTACK_LINE) int capacity;
+  ///Pool of nodes of this stack.
+  SLFStackNode* nodes;
+}SLFStack;
+
+/**
+ * Lock-free stack definition.
+ */
+typedef SLFStack* LFStack;
+
+//==============================================================================
+
+/**
+ * Creates a lock-free stack.
+ *
+ * @param capacity the capacity of the stack (a positive number)
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new stack otherwise
+ */
+LFStack newLFStack(int capacity);
+
+/**
+ * Deletes a lock-free stack.
+ *
+ * @attention
+ * This function only frees the memory used by the stack.  It does not free the
+ * memory used by elements the stack contains.
+ *
+ * @param stack the stack to be deleted
+ */
+void lfstackDelete(LFStack stack);
+
+/**
+ * Inserts an element at the top of a lock-free stack.
+ *
+ * @param stack the stack
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if the stack was full
+ */
+int lfstackPush(LFStack stack,void* value);
+
+/**
+ * Removes an element from the top of a lock-free stack.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @param stack the stack
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 if the stack was empty
+ */
+int lfstackPop(LFStack stack,void** value);
+
+/**
+ * Returns the approximate size of a lock-free stack.
+ *
+ * The size may be outdated as soon as it is returned, when the stack is being
+ * used by other threads.
+ *
+ * @param stack the stack
+ *
+ * @return
+ * the approximate size of the stack
+ */
+int lfstackSize(LFStack stack);
+
+/**
+ * Returns the capacity of a lock-free stack.
+ *
+ * @param stack the stack
+ *
+ * @return
+ * the capacity of the stack
+ */
+int lfstackCapacity(LFStack stack);
+
+#endif
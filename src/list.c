@@ -295,6 +295,239 @@ int listAt(List list,int index,void** value)
 
 //==============================================================================
 
+ListNode listFstNode(List list)
+{
+  return list->first;
+}
+
+//==============================================================================
+
+ListNode listLstNode(List list)
+{
+  return list->last;
+}
+
+//==============================================================================
+
+ListNode listNodeAt(List list,int index)
+{
+  int size=listSize(list);
+  ListNode aux=NULL;
+  if(index>=0&&index<size)
+  {
+    if(index>size/2)
+      for(index=size-index-1,aux=list->last;index>0;index--,aux=aux->prev);
+    else for(aux=list->first;index>0;index--,aux=aux->next);
+  }
+  return aux;
+}
+
+//==============================================================================
+
+/**
+ * Links a node between two consecutive nodes of a list.
+ *
+ * @param list the list
+ * @param prev the previous node (or <tt>NULL</tt>)
+ * @param next the next node (or <tt>NULL</tt>)
+ * @param node the node to be linked
+ */
+static void listLink(List list,ListNode prev,ListNode next,ListNode node)
+{
+  node->prev=prev;
+  node->next=next;
+  if(prev) prev->next=node;
+  else list->first=node;
+  if(next) next->prev=node;
+  else list->last=node;
+  list->size++;
+}
+
+//==============================================================================
+
+/**
+ * Unlinks a node from a list, without freeing it.
+ *
+ * @param list the list
+ * @param node the node to be unlinked
+ */
+static void listUnlink(List list,ListNode node)
+{
+  if(node->prev) node->prev->next=node->next;
+  else list->first=node->next;
+  if(node->next) node->next->prev=node->prev;
+  else list->last=node->prev;
+  list->size--;
+}
+
+//==============================================================================
+
+ListNode listInsertBefore(List list,ListNode node,void* value)
+{
+  ListNode new=malloc(sizeof(SListNode));
+  if(new)
+  {
+    new->value=value;
+    listLink(list,node?node->prev:list->last,node,new);
+  }
+  return new;
+}
+
+//==============================================================================
+
+ListNode listInsertAfter(List list,ListNode node,void* value)
+{
+  ListNode new=malloc(sizeof(SListNode));
+  if(new)
+  {
+    new->value=value;
+    listLink(list,node,node?node->next:list->first,new);
+  }
+  return new;
+}
+
+//==============================================================================
+
+void listRemoveNode(List list,ListNode node,void** value)
+{
+  if(value) *value=node->value;
+  listUnlink(list,node);
+  free(node);
+}
+
+//==============================================================================
+
+void listMoveFst(List list,ListNode node)
+{
+  if(node!=list->first)
+  {
+    listUnlink(list,node);
+    listLink(list,NULL,list->first,node);
+  }
+}
+
+//==============================================================================
+
+void listMoveLst(List list,ListNode node)
+{
+  if(node!=list->last)
+  {
+    listUnlink(list,node);
+    listLink(list,list->last,NULL,node);
+  }
+}
+
+//==============================================================================
+
+void listConcat(List dst,List src)
+{
+  if(src->size&&dst!=src)
+  {
+    if(dst->last) dst->last->next=src->first;
+    else dst->first=src->first;
+    src->first->prev=dst->last;
+    dst->last=src->last;
+    dst->size+=src->size;
+    src->first=NULL;
+    src->last=NULL;
+    src->size=0;
+  }
+}
+
+//==============================================================================
+
+/**
+ * Relinks a range of nodes from a list before a node of another list (or of
+ * the same list).
+ *
+ * @param dst   the list that receives the nodes
+ * @param pos   the node before which the range is inserted (or <tt>NULL</tt>)
+ * @param src   the list that holds the range
+ * @param first the first node of the range
+ * @param last  the last node of the range
+ * @param n     the number of nodes of the range
+ */
+static void listRelink(List dst,ListNode pos,List src,ListNode first,
+    ListNode last,int n)
+{
+  if(first->prev) first->prev->next=last->next;
+  else src->first=last->next;
+  if(last->next) last->next->prev=first->prev;
+  else src->last=first->prev;
+  src->size-=n;
+  first->prev=pos?pos->prev:dst->last;
+  last->next=pos;
+  if(first->prev) first->prev->next=first;
+  else dst->first=first;
+  if(pos) pos->prev=last;
+  else dst->last=last;
+  dst->size+=n;
+}
+
+//==============================================================================
+
+void listSplice(List dst,ListNode pos,List src,ListNode first,ListNode last)
+{
+  int n=1;
+  ListNode aux;
+  if(dst!=src) for(aux=first;aux!=last;aux=aux->next) n++;
+  listRelink(dst,pos,src,first,last,n);
+}
+
+//==============================================================================
+
+int listSplitAt(List list,int index,List rest)
+{
+  int result=0;
+  if(index<0||index>list->size) result=1;
+  else if(index<list->size)
+  {
+    listRelink(rest,NULL,list,listNodeAt(list,index),list->last,
+               list->size-index);
+  }
+  return result;
+}
+
+//==============================================================================
+
+void listSort(List list,int(*comp)(void*,void*))
+{
+  int i,n,merges,lsize,rsize;
+  ListNode left,right,next,head=list->first,tail;
+  for(n=1,merges=2;merges>1;n*=2)
+  {
+    for(merges=0,left=head,head=NULL,tail=NULL;left;merges++)
+    {
+      for(i=0,right=left;i<n&&right;i++) right=right->next;
+      for(lsize=i,rsize=n;lsize>0||(rsize>0&&right);)
+      {
+        if(!lsize||(rsize>0&&right&&comp(left->value,right->value)>0))
+        {
+          next=right;
+          right=right->next;
+          rsize--;
+        }
+        else
+        {
+          next=left;
+          left=left->next;
+          lsize--;
+        }
+        if(tail) tail->next=next;
+        else head=next;
+        next->prev=tail;
+        tail=next;
+      }
+      left=right;
+    }
+    if(tail) tail->next=NULL;
+  }
+  list->first=head;
+  list->last=tail;
+}
+
+//==============================================================================
+
 int listSize(List list)
 {
   return list->size;
@@ -332,3 +565,37 @@ Iterator listIterator(List list)
   }
   return it;
 }
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator over a list.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int listLazyNext(LazyIt it,void** val)
+{
+  int result=0;
+  ListNode aux=it->state[0];
+  if(!aux) result=1;
+  else
+  {
+    *val=aux->value;
+    it->state[0]=aux->next;
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt listLazy(List list)
+{
+  LazyIt it=newLazy(listLazyNext,NULL);
+  if(it) it->state[0]=list->first;
+  return it;
+}
@@ -12,6 +12,7 @@
 #define _LIST_H_
 
 #include "iterator.h"
+#include "lazyit.h"
 
 /**
  * Linked list node structure.
@@ -229,6 +230,178 @@ int listLst(List list,void** value);
  */
 int listAt(List list,int index,void** value);
 
+/**
+ * Provides the first node of a list.
+ *
+ * Nodes can be used as cursors: they remain valid until they are removed from
+ * the list, and allow inserting and removing elements at their position in
+ * constant time (see <tt>@ref listInsertBefore</tt>,
+ * <tt>@ref listInsertAfter</tt>, and <tt>@ref listRemoveNode</tt>).  The
+ * neighbours of a node are given by its <tt>prev</tt> and <tt>next</tt>
+ * fields.
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if the list is empty\n
+ * the first node otherwise
+ */
+ListNode listFstNode(List list);
+
+/**
+ * Provides the last node of a list.
+ *
+ * @see listFstNode
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if the list is empty\n
+ * the last node otherwise
+ */
+ListNode listLstNode(List list);
+
+/**
+ * Provides the node at the specified position of a list.
+ *
+ * @see listFstNode
+ *
+ * @param list  the list
+ * @param index the index of the node to be provided
+ *
+ * @return
+ * <tt>NULL</tt> if the value of <tt>index</tt> was invalid\n
+ * the node at the specified position otherwise
+ */
+ListNode listNodeAt(List list,int index);
+
+/**
+ * Inserts an element before a node of a list.
+ *
+ * If <tt>node</tt> is <tt>NULL</tt>, the element is inserted at the end of the
+ * list.
+ *
+ * @param list  the list
+ * @param node  the node (or <tt>NULL</tt>)
+ * @param value the value to be inserted
+ *
+ * @return
+ * <tt>NULL</tt> if it was not possible to insert the new element\n
+ * the node of the new element otherwise
+ */
+ListNode listInsertBefore(List list,ListNode node,void* value);
+
+/**
+ * Inserts an element after a node of a list.
+ *
+ * If <tt>node</tt> is <tt>NULL</tt>, the element is inserted at the beginning
+ * of the list.
+ *
+ * @param list  the list
+ * @param node  the node (or <tt>NULL</tt>)
+ * @param value the value to be inserted
+ *
+ * @return
+ * <tt>NULL</tt> if it was not possible to insert the new element\n
+ * the node of the new element otherwise
+ */
+ListNode listInsertAfter(List list,ListNode node,void* value);
+
+/**
+ * Removes a node from a list.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.  The node is freed, and it must not be used afterwards.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param list  the list
+ * @param node  the node to be removed
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ */
+void listRemoveNode(List list,ListNode node,void** value);
+
+/**
+ * Moves a node of a list to the beginning of the list.
+ *
+ * @param list the list
+ * @param node the node to be moved
+ */
+void listMoveFst(List list,ListNode node);
+
+/**
+ * Moves a node of a list to the end of the list.
+ *
+ * @param list the list
+ * @param node the node to be moved
+ */
+void listMoveLst(List list,ListNode node);
+
+/**
+ * Moves all the elements of a list to the end of another list.
+ *
+ * The nodes of <tt>src</tt> are relinked into <tt>dst</tt> in constant time,
+ * and <tt>src</tt> becomes empty.
+ *
+ * @param dst the list that receives the elements
+ * @param src the list whose elements are moved
+ */
+void listConcat(List dst,List src);
+
+/**
+ * Moves a range of nodes from a list to another list (or to another position
+ * of the same list).
+ *
+ * The nodes from <tt>first</tt> to <tt>last</tt> (inclusive) of <tt>src</tt>
+ * are relinked before node <tt>pos</tt> of <tt>dst</tt> (or at the end of
+ * <tt>dst</tt>, if <tt>pos</tt> is <tt>NULL</tt>), without allocating memory.
+ * When <tt>dst</tt> and <tt>src</tt> are different lists, the nodes of the
+ * range are counted, in order to update the sizes of the lists.
+ *
+ * @attention
+ * <tt>last</tt> must not precede <tt>first</tt>, and when <tt>dst</tt> and
+ * <tt>src</tt> are the same list, <tt>pos</tt> must not be in the range.
+ *
+ * @param dst   the list that receives the nodes
+ * @param pos   the node before which the range is inserted (or <tt>NULL</tt>)
+ * @param src   the list that holds the range
+ * @param first the first node of the range
+ * @param last  the last node of the range
+ */
+void listSplice(List dst,ListNode pos,List src,ListNode first,ListNode last);
+
+/**
+ * Splits a list at the specified position.
+ *
+ * The elements from position <tt>index</tt> onwards are moved to the end of
+ * list <tt>rest</tt>, without allocating memory.  The position must be a non
+ * negative integer, and not greater than the current size of the list.
+ *
+ * @param list  the list
+ * @param index the index of the first element to be moved
+ * @param rest  the list that receives the elements
+ *
+ * @return
+ * 0 if the list was split\n
+ * 1 if the value of <tt>index</tt> was invalid
+ */
+int listSplitAt(List list,int index,List rest);
+
+/**
+ * Sorts a list into ascending order, based on a given comparison function.
+ *
+ * Uses a bottom-up <em>merge sort</em> that relinks the nodes of the list, so
+ * it takes O(n log n) time, uses constant extra memory, and is stable.  The
+ * comparison function must return a positive value when its first argument is
+ * greater than the second one, and a non positive value otherwise.
+ *
+ * @param list the list
+ * @param comp comparison function
+ */
+void listSort(List list,int(*comp)(void*,void*));
+
 /**
  * Returns the size of a list.
  *
@@ -266,4 +439,17 @@ int listMap(List list,void(*fun)(void*));
  */
 Iterator listIterator(List list);
 
+/**
+ * Creates a lazy iterator from a list.
+ *
+ * @see LazyIt
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt listLazy(List list);
+
 #endif
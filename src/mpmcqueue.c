@@ -0,0 +1,179 @@
+/**
+ * Implementation of a lock-free multi-producer/multi-consumer queue.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file mpmcqueue.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include "mpmcqueue.h"
+
+MPMCQueue newMPMCQueue(int capacity)
+{
+  size_t i,size=2;
+  MPMCQueue queue=NULL;
+  if(capacity>0&&capacity<=1<<30)
+  {
+    for(;size<(size_t)capacity;size<<=1);
+    queue=aligned_alloc(MPMC_LINE,sizeof(SMPMCQueue));
+    if(queue)
+    {
+      queue->cells=malloc(size*sizeof(SMPMCCell));
+      if(!queue->cells)
+      {
+        free(queue);
+        queue=NULL;
+      }
+      else
+      {
+        for(i=0;i<size;i++)
+        {
+          atomic_init(&queue->cells[i].seq,i);
+          atomic_init(&queue->cells[i].value,NULL);
+        }
+        atomic_init(&queue->tail,0);
+        atomic_init(&queue->head,0);
+        queue->mask=size-1;
+      }
+    }
+  }
+  return queue;
+}
+
+//==============================================================================
+
+void mpmcDelete(MPMCQueue queue)
+{
+  free(queue->cells);
+  free(queue);
+}
+
+//==============================================================================
+
+/**
+ * Claims a position of a multi-producer/multi-consumer queue.
+ *
+ * A position is claimed from <tt>index</tt> when the sequence number of its
+ * cell is equal to the position plus <tt>ready</tt> (0 for producers, and 1
+ * for consumers).
+ *
+ * @param queue the queue
+ * @param index the index positions are claimed from
+ * @param ready the difference between sequence number and position of a cell
+ * that is ready
+ * @param pos   pointer where the claimed position will be put
+ *
+ * @return
+ * 0 if a position was claimed\n
+ * 1 if the queue was full (for producers) or empty (for consumers)
+ */
+static int mpmcClaim(MPMCQueue queue,atomic_size_t* index,size_t ready,
+    size_t* pos)
+{
+  int done=0,result=0;
+  intptr_t dif;
+  size_t seq,cur=atomic_load_explicit(index,memory_order_relaxed);
+  while(!done)
+  {
+    seq=atomic_load_explicit(&queue->cells[cur&queue->mask].seq,
+                             memory_order_acquire);
+    dif=(intptr_t)seq-(intptr_t)(cur+ready);
+    if(!dif)
+    {
+      done=atomic_compare_exchange_weak_explicit(index,&cur,cur+1,
+                                                 memory_order_relaxed,
+                                                 memory_order_relaxed);
+    }
+    else if(dif<0)
+    {
+      result=1;
+      done=1;
+    }
+    else cur=atomic_load_explicit(index,memory_order_relaxed);
+  }
+  *pos=cur;
+  return result;
+}
+
+//==============================================================================
+
+int mpmcInsert(MPMCQueue queue,void* value)
+{
+  size_t pos;
+  SMPMCCell* cell;
+  int result=mpmcClaim(queue,&queue->tail,0,&pos);
+  if(!result)
+  {
+    cell=&queue->cells[pos&queue->mask];
+    atomic_store_explicit(&cell->value,value,memory_order_relaxed);
+    atomic_store_explicit(&cell->seq,pos+1,memory_order_release);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int mpmcRemove(MPMCQueue queue,void** value)
+{
+  size_t pos;
+  void* aux=NULL;
+  SMPMCCell* cell;
+  int result=mpmcClaim(queue,&queue->head,1,&pos);
+  if(!result)
+  {
+    cell=&queue->cells[pos&queue->mask];
+    aux=atomic_load_explicit(&cell->value,memory_order_relaxed);
+    atomic_store_explicit(&cell->seq,pos+queue->mask+1,memory_order_release);
+  }
+  if(value) *value=aux;
+  return result;
+}
+
+//==============================================================================
+
+int mpmcConsult(MPMCQueue queue,void** value)
+{
+  int done=0,result=0;
+  size_t pos,seq;
+  SMPMCCell* cell;
+  while(!done)
+  {
+    pos=atomic_load_explicit(&queue->head,memory_order_acquire);
+    cell=&queue->cells[pos&queue->mask];
+    seq=atomic_load_explicit(&cell->seq,memory_order_acquire);
+    if(seq!=pos+1)
+    {
+      if((intptr_t)seq-(intptr_t)(pos+1)<0)
+      {
+        *value=NULL;
+        result=1;
+        done=1;
+      }
+    }
+    else
+    {
+      *value=atomic_load_explicit(&cell->value,memory_order_relaxed);
+      atomic_thread_fence(memory_order_acquire);
+      done=atomic_load_explicit(&cell->seq,memory_order_relaxed)==seq;
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+int mpmcSize(MPMCQueue queue)
+{
+  size_t head=atomic_load_explicit(&queue->head,memory_order_acquire);
+  size_t size=atomic_load_explicit(&queue->tail,memory_order_acquire)-head;
+  return size>queue->mask?(int)(queue->mask+1):(int)size;
+}
+
+//==============================================================================
+
+int mpmcCapacity(MPMCQueue queue)
+{
+  return (int)(queue->mask+1);
+}
@@ -0,0 +1,162 @@
+/**
+ * Implementation of a lock-free multi-producer/multi-consumer queue.
+ *
+ * Provides functions to create and manipulate a bounded queue that can be used
+ * by any number of producer and consumer threads at the same time, without
+ * locks.
+ *
+ * The elements are stored in a circular buffer whose capacity is a power of
+ * two.  Each cell of the buffer holds a sequence number, which tells whether
+ * the cell is ready to be written by the producer that claims a given position,
+ * or to be read by the consumer that claims it (as in the bounded queue
+ * proposed by Dmitry Vyukov).  Producers and consumers only contend on the
+ * index they claim positions from, using a compare-and-swap, and never on the
+ * cells themselves.
+ *
+ * Requires C11 atomics (<tt>stdatomic.h</tt>).
+ *
+ * @author Rui Carlos Gonçalves
+ * @file mpmcqueue.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _MPMCQUEUE_H_
+#define _MPMCQUEUE_H_
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/**
+ * Size of a cache line (in bytes).
+ */
+#define MPMC_LINE 64
+
+/**
+ * Multi-producer/multi-consumer queue cell structure.
+ */
+typedef struct sMPMCCell
+{
+  ///Sequence number of this cell.
+  atomic_size_t seq;
+  ///Cell's value.
+  _Atomic(void*) value;
+}SMPMCCell;
+
+/**
+ * Multi-producer/multi-consumer queue structure.
+ */
+typedef struct sMPMCQueue
+{
+  ///Next position to be claimed by a producer.
+  _Alignas(MPMC_LINE) atomic_size_t tail;
+  ///Next position to be claimed by a consumer.
+  _Alignas(MPMC_LINE) atomic_size_t head;
+  ///Capacity of this queue minus 1 (the capacity is a power of two).
+  _Alignas(MPMC_LINE) size_t mask;
+  ///Buffer of this queue.
+  SMPMCCell* cells;
+}SMPMCQueue;
+
+/**
+ * Multi-producer/multi-consumer queue definition.
+ */
+typedef SMPMCQueue* MPMCQueue;
+
+//==============================================================================
+
+/**
+ * Creates a multi-producer/multi-consumer queue.
+ *
+ * The capacity must be a positive number, and it is rounded up to a power of
+ * two (not less than 2).
+ *
+ * @param capacity the capacity of the queue
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new queue otherwise
+ */
+MPMCQueue newMPMCQueue(int capacity);
+
+/**
+ * Deletes a multi-producer/multi-consumer queue.
+ *
+ * @attention
+ * This function only frees the memory used by the queue.  It does not free the
+ * memory used by elements the queue contains.
+ *
+ * @param queue the queue to be deleted
+ */
+void mpmcDelete(MPMCQueue queue);
+
+/**
+ * Inserts an element in a multi-producer/multi-consumer queue.
+ *
+ * @param queue the queue
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if the queue was full
+ */
+int mpmcInsert(MPMCQueue queue,void* value);
+
+/**
+ * Removes an element from a multi-producer/multi-consumer queue.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @param queue the queue
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 if the queue was empty
+ */
+int mpmcRemove(MPMCQueue queue,void** value);
+
+/**
+ * Provides the value at the head of a multi-producer/multi-consumer queue.
+ *
+ * If the queue is empty, it will be put the value <tt>NULL</tt> at
+ * <tt>value</tt>.
+ *
+ * @attention
+ * When there are other consumers, the element may be removed by one of them
+ * as soon as it is provided.
+ *
+ * @param queue the queue
+ * @param value pointer where the value at the head will be put
+ *
+ * @return
+ * 0 if the queue was not empty\n
+ * 1 otherwise
+ */
+int mpmcConsult(MPMCQueue queue,void** value);
+
+/**
+ * Returns the approximate size of a multi-producer/multi-consumer queue.
+ *
+ * The size may be outdated as soon as it is returned, when the queue is being
+ * used by other threads.
+ *
+ * @param queue the queue
+ *
+ * @return
+ * the approximate size of the queue
+ */
+int mpmcSize(MPMCQueue queue);
+
+/**
+ * Returns the capacity of a multi-producer/multi-consumer queue.
+ *
+ * @param queue the queue
+ *
+ * @return
+ * the capacity of the queue
+ */
+int mpmcCapacity(MPMCQueue queue);
+
+#endif
@@ -0,0 +1,228 @@
+/**
+ * Parallel traversal of AVL trees.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ptreemap.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include <pthread.h>
+#include "ptreemap.h"
+
+/**
+ * Minimum number of subtrees to be created per thread.
+ */
+#define TASKS 4
+
+/**
+ * Structure that holds the subtrees to be processed, and the operation to be
+ * applied to them.
+ */
+typedef struct sTreeTasks
+{
+  ///Subtrees to be processed.
+  TreeNode* nodes;
+  ///Number of subtrees.
+  int size;
+  ///Next subtree to be claimed.
+  int next;
+  ///Lock that protects <tt>next</tt>.
+  pthread_mutex_t lock;
+  ///Function to be applied (or <tt>NULL</tt> when reducing).
+  void(*fun)(void*,void*);
+  ///Function that adds an element to a partial result.
+  void*(*red)(void*,void*,void*);
+}STreeTasks;
+
+/**
+ * Structure that holds the state of a thread.
+ */
+typedef struct sTreeWorker
+{
+  ///Shared subtrees.
+  STreeTasks* tasks;
+  ///Partial result of this thread.
+  void* acc;
+}STreeWorker;
+
+//==============================================================================
+
+/**
+ * Processes a node.
+ *
+ * @param worker the worker
+ * @param node   the node
+ */
+static void treeVisit(STreeWorker* worker,TreeNode node)
+{
+  if(worker->tasks->fun) worker->tasks->fun(node->key,node->value);
+  else worker->acc=worker->tasks->red(worker->acc,node->key,node->value);
+}
+
+//==============================================================================
+
+/**
+ * Processes all the nodes of a subtree.
+ *
+ * @param worker the worker
+ * @param node   the root of the subtree
+ */
+static void treeVisitAll(STreeWorker* worker,TreeNode node)
+{
+  if(node)
+  {
+    treeVisit(worker,node);
+    treeVisitAll(worker,node->left);
+    treeVisitAll(worker,node->right);
+  }
+}
+
+//==============================================================================
+
+/**
+ * Collects the subtrees at a given depth, and processes the nodes above them.
+ *
+ * @param worker the worker that processes the nodes above the subtrees
+ * @param node   the root of the tree
+ * @param depth  the depth of the subtrees
+ */
+static void treeSplit(STreeWorker* worker,TreeNode node,int depth)
+{
+  if(node)
+  {
+    if(!depth) worker->tasks->nodes[worker->tasks->size++]=node;
+    else
+    {
+      treeVisit(worker,node);
+      treeSplit(worker,node->left,depth-1);
+      treeSplit(worker,node->right,depth-1);
+    }
+  }
+}
+
+//==============================================================================
+
+/**
+ * Claims and processes subtrees until none is left.
+ *
+ * @param arg the worker
+ *
+ * @return
+ * <tt>NULL</tt>
+ */
+static void* treeWork(void* arg)
+{
+  int i;
+  STreeWorker* worker=arg;
+  STreeTasks* tasks=worker->tasks;
+  do
+  {
+    pthread_mutex_lock(&tasks->lock);
+    i=tasks->next<tasks->size?tasks->next++:-1;
+    pthread_mutex_unlock(&tasks->lock);
+    if(i>=0) treeVisitAll(worker,tasks->nodes[i]);
+  }
+  while(i>=0);
+  return NULL;
+}
+
+//==============================================================================
+
+/**
+ * Processes all the nodes of a tree using multiple threads.
+ *
+ * @param tree     the tree
+ * @param tasks    the operation to be applied
+ * @param init     the initial value of each partial result
+ * @param comb     the function that combines two partial results (or
+ * <tt>NULL</tt>)
+ * @param nthreads the number of threads
+ *
+ * @return
+ * the combined partial results
+ */
+static void* treeParAux(TreeMap tree,STreeTasks* tasks,void* init,
+    void*(*comb)(void*,void*),int nthreads)
+{
+  int i,n,depth;
+  void* result;
+  pthread_t* threads;
+  STreeWorker* workers;
+  STreeWorker single;
+  if(nthreads<1) nthreads=1;
+  for(depth=0;(1<<depth)<TASKS*nthreads;depth++);
+  tasks->nodes=malloc((1<<depth)*sizeof(TreeNode));
+  threads=malloc(nthreads*sizeof(pthread_t));
+  workers=malloc(nthreads*sizeof(STreeWorker));
+  if(!tasks->nodes||!threads||!workers||pthread_mutex_init(&tasks->lock,NULL))
+  {
+    single.tasks=tasks;
+    single.acc=init;
+    treeVisitAll(&single,tree->root);
+    result=single.acc;
+  }
+  else
+  {
+    for(i=0;i<nthreads;i++)
+    {
+      workers[i].tasks=tasks;
+      workers[i].acc=init;
+    }
+    tasks->size=0;
+    tasks->next=0;
+    treeSplit(&workers[0],tree->root,depth);
+    for(n=1;n<nthreads&&!pthread_create(&threads[n],NULL,treeWork,&workers[n]);
+        n++);
+    treeWork(&workers[0]);
+    result=workers[0].acc;
+    for(i=1;i<n;i++)
+    {
+      pthread_join(threads[i],NULL);
+      if(comb) result=comb(result,workers[i].acc);
+    }
+    pthread_mutex_destroy(&tasks->lock);
+  }
+  free(tasks->nodes);
+  free(threads);
+  free(workers);
+  return result;
+}
+
+//==============================================================================
+
+int treeParMap(TreeMap tree,void(*fun)(void*,void*),int nthreads)
+{
+  int result=0;
+  STreeTasks tasks;
+  if(!fun) result=2;
+  else if(!tree->size) result=1;
+  else
+  {
+    tasks.fun=fun;
+    tasks.red=NULL;
+    treeParAux(tree,&tasks,NULL,NULL,nthreads);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int treeParReduce(TreeMap tree,void* init,void*(*fun)(void*,void*,void*),
+    void*(*comb)(void*,void*),int nthreads,void** result)
+{
+  int ret=0;
+  STreeTasks tasks;
+  if(!fun||!comb||!tree->size)
+  {
+    *result=init;
+    ret=!fun||!comb?2:1;
+  }
+  else
+  {
+    tasks.fun=NULL;
+    tasks.red=fun;
+    *result=treeParAux(tree,&tasks,init,comb,nthreads);
+  }
+  return ret;
+}
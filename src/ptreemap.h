@@ -0,0 +1,93 @@
+/**
+ * Parallel traversal of AVL trees.
+ *
+ * Provides functions to apply a function to all the elements of a tree, and to
+ * reduce the elements of a tree to a single value, using multiple threads.
+ *
+ * The tree is split into independent subtrees, which are handed to a pool of
+ * POSIX threads.  Each thread claims subtrees until none is left, so that
+ * unbalanced workloads are spread among the threads.  The nodes above the
+ * subtrees (a small number, proportional to the number of threads) are
+ * processed by the calling thread.
+ *
+ * @attention
+ * The tree must not be modified while these functions are running, and the
+ * functions provided must be safe to be called concurrently.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ptreemap.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _PTREEMAP_H_
+#define _PTREEMAP_H_
+
+#include "treemap.h"
+
+/**
+ * Applies a function to the elements of a tree, using multiple threads.
+ *
+ * The function to be applied must be of type <tt>void fun(void*,void*)</tt>
+ * (it receives the key and the value of each element).  The order in which the
+ * elements are visited is not specified.
+ *
+ * If it is not possible to create the threads, the remaining work is done by
+ * the calling thread.
+ *
+ * @param tree     the tree
+ * @param fun      the function to be applied
+ * @param nthreads the number of threads to be used (including the calling
+ * thread)
+ *
+ * @return
+ * 0 if the function was applied\n
+ * 1 if the tree was empty\n
+ * 2 if <tt>fun</tt> was <tt>NULL</tt>
+ */
+int treeParMap(TreeMap tree,void(*fun)(void*,void*),int nthreads);
+
+/**
+ * Reduces the elements of a tree to a single value, using multiple threads.
+ *
+ * Each thread computes a partial result, starting with <tt>init</tt> and
+ * applying <tt>fun</tt>, of type <tt>void* fun(void* acc,void* key,void*
+ * value)</tt>, to the partial result and to each element it visits.  The
+ * partial results are then combined using <tt>comb</tt>, of type <tt>void*
+ * comb(void*,void*)</tt>.
+ *
+ * Since the elements are distributed dynamically among threads,
+ * <tt>comb</tt> must be associative and commutative, and <tt>init</tt> must be
+ * an identity value for it.  The value <tt>init</tt> is shared by all partial
+ * results, and therefore it must not be modified by <tt>fun</tt>.
+ *
+ * E.g. (sum of values):
+\code
+void* sum(void* acc,void* key,void* value)
+{
+  return (void*)((long)acc+(long)value);
+}
+
+void* comb(void* acc1,void* acc2)
+{
+  return (void*)((long)acc1+(long)acc2);
+}
+\endcode
+ *
+ * @param tree     the tree
+ * @param init     the initial value of each partial result
+ * @param fun      the function that adds an element to a partial result
+ * @param comb     the function that combines two partial results
+ * @param nthreads the number of threads to be used (including the calling
+ * thread)
+ * @param result   pointer where the result will be put
+ *
+ * @return
+ * 0 if the elements were reduced\n
+ * 1 if the tree was empty (<tt>init</tt> is put at <tt>result</tt>)\n
+ * 2 if <tt>fun</tt> or <tt>comb</tt> was <tt>NULL</tt> (<tt>init</tt> is put
+ * at <tt>result</tt>)
+ */
+int treeParReduce(TreeMap tree,void* init,void*(*fun)(void*,void*,void*),
+    void*(*comb)(void*,void*),int nthreads,void** result);
+
+#endif
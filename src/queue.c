@@ -1,22 +1,39 @@
 /**
- * Implementation of a queue as linked list.
- * 
+ * Implementation of a queue as a circular buffer.
+ *
  * @author Rui Carlos Gonçalves
  * @file queue.c
  * @version 3.0.1
  * @date 01/2014
  */
+#include <limits.h>
 #include <stdlib.h>
+#include <string.h>
 #include "queue.h"
 
+/**
+ * Given a queue (<tt>Q</tt>) and an offset from its head (<tt>I</tt>),
+ * provides the corresponding position of the buffer.
+ */
+#define POS(Q,I) (((Q)->head+(I))&((Q)->capacity-1))
+
 Queue newQueue(void)
 {
   Queue queue=malloc(sizeof(SQueue));
   if(queue)
   {
-    queue->size=0;
-    queue->head=NULL;
-    queue->last=NULL;
+    queue->values=malloc(QUEUE_CAPACITY*sizeof(void*));
+    if(!queue->values)
+    {
+      free(queue);
+      queue=NULL;
+    }
+    else
+    {
+      queue->size=0;
+      queue->capacity=QUEUE_CAPACITY;
+      queue->head=0;
+    }
   }
   return queue;
 }
@@ -25,18 +42,40 @@ Queue newQueue(void)
 
 void queueDelete(Queue queue)
 {
-  QueueNode aux1,aux2;
-  if(!queue->size) free(queue);
+  free(queue->values);
+  free(queue);
+}
+
+//==============================================================================
+
+/**
+ * Doubles the capacity of a queue.
+ *
+ * The elements that wrapped around the end of the buffer are moved to the new
+ * half of the buffer, so that the elements remain contiguous from the head.
+ *
+ * @param queue the queue
+ *
+ * @return
+ * 0 if the capacity was doubled\n
+ * 1 otherwise
+ */
+static int queueGrow(Queue queue)
+{
+  int wrapped,result=0;
+  void** newvalues=NULL;
+  if(queue->capacity<=INT_MAX/2)
+    newvalues=realloc(queue->values,2*queue->capacity*sizeof(void*));
+  if(!newvalues) result=1;
   else
   {
-    for(aux1=queue->head;aux1;)
-    {
-      aux2=aux1;
-      aux1=aux1->next;
-      free(aux2);
-    }
-    free(queue);
+    wrapped=queue->head+queue->size-queue->capacity;
+    if(wrapped>0)
+      memcpy(newvalues+queue->capacity,newvalues,wrapped*sizeof(void*));
+    queue->values=newvalues;
+    queue->capacity*=2;
   }
+  return result;
 }
 
 //==============================================================================
@@ -44,18 +83,12 @@ void queueDelete(Queue queue)
 int queueInsert(Queue queue,void* value)
 {
   int result=0;
-  QueueNode new;
-  new=malloc(sizeof(SQueueNode));
-  if(new)
+  if(queue->size==queue->capacity) result=queueGrow(queue);
+  if(!result)
   {
-    new->value=value;
-    new->next=NULL;
-    if(!queue->size) queue->head=new;
-    else queue->last->next=new;
-    queue->last=new;
+    queue->values[POS(queue,queue->size)]=value;
     queue->size++;
   }
-  else result=1;
   return result;
 }
 
@@ -64,7 +97,6 @@ int queueInsert(Queue queue,void* value)
 int queueRemove(Queue queue,void** value)
 {
   int result=0;
-  QueueNode aux;
   if(!queue->size)
   {
     if(value) *value=NULL;
@@ -72,19 +104,8 @@ int queueRemove(Queue queue,void** value)
   }
   else
   {
-    if(value) *value=queue->head->value;
-    if(queue->size==1)
-    {
-      free(queue->head);
-      queue->last=NULL;
-      queue->head=NULL;
-    }
-    else
-    {
-      aux=queue->head;
-      queue->head=queue->head->next;
-      free(aux);
-    }
+    if(value) *value=queue->values[queue->head];
+    queue->head=POS(queue,1);
     queue->size--;
   }
   return result;
@@ -100,7 +121,7 @@ int queueConsult(Queue queue,void** value)
     *value=NULL;
     result=1;
   }
-  else *value=queue->head->value;
+  else *value=queue->values[queue->head];
   return result;
 }
 
@@ -115,13 +136,12 @@ int queueSize(Queue queue)
 
 int queueMap(Queue queue,void(*fun)(void*))
 {
-  int result=0;
-  QueueNode aux;
+  int i,result=0;
   if(queue->size==0) result=1;
   else
   {
-    for(aux=queue->head;aux;aux=aux->next)
-      fun(aux->value);
+    for(i=0;i<queue->size;i++)
+      fun(queue->values[POS(queue,i)]);
   }
   return result;
 }
@@ -130,12 +150,11 @@ int queueMap(Queue queue,void(*fun)(void*))
 
 Iterator queueIterator(Queue queue)
 {
-  int ctrl;
-  QueueNode aux;
+  int ctrl,i;
   Iterator it;
   it=newIt(queue->size);
-  for(aux=queue->head,ctrl=0;aux&&!ctrl;aux=aux->next)
-    ctrl=itAdd(it,aux->value);
+  for(i=0,ctrl=0;i<queue->size&&!ctrl;i++)
+    ctrl=itAdd(it,queue->values[POS(queue,i)]);
   if(ctrl)
   {
     itDelete(it);
@@ -143,3 +162,36 @@ Iterator queueIterator(Queue queue)
   }
   return it;
 }
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator over a queue.
+ *
+ * The state of the iterator holds the queue, and the offset of the next
+ * element from the head of the queue.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int queueLazyNext(LazyIt it,void** val)
+{
+  int result=0;
+  Queue queue=it->state[0];
+  if(it->index[0]>=queue->size) result=1;
+  else *val=queue->values[POS(queue,it->index[0]++)];
+  return result;
+}
+
+//==============================================================================
+
+LazyIt queueLazy(Queue queue)
+{
+  LazyIt it=newLazy(queueLazyNext,NULL);
+  if(it) it->state[0]=queue;
+  return it;
+}
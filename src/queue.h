@@ -1,8 +1,12 @@
 /**
- * Implementation of a queue as linked list.
+ * Implementation of a queue as a circular buffer.
  *
  * Provides functions to create and manipulate a queue.
  *
+ * The elements are stored contiguously in a buffer whose capacity is a power
+ * of two, so that positions wrap around with a mask.  The capacity is doubled
+ * when the buffer is full, and no memory is allocated otherwise.
+ *
  * @author Rui Carlos Gonçalves
  * @file queue.h
  * @version 3.0.1
@@ -12,22 +16,12 @@
 #define _QUEUE_H_
 
 #include "iterator.h"
+#include "lazyit.h"
 
 /**
- * Queue node structure.
+ * Initial capacity of a queue (must be a power of two).
  */
-typedef struct sQueueNode
-{
-  ///Node's value.
-  void* value;
-  ///Next node.
-  struct sQueueNode* next;
-}SQueueNode;
-
-/**
- * Queue node definition.
- */
-typedef SQueueNode* QueueNode;
+#define QUEUE_CAPACITY 16
 
 /**
  * Queue structure.
@@ -36,11 +30,12 @@ typedef struct sQueue
 {
   ///Number of elements of this queue.
   int size;
-  ///Apontador para o início da queue.
-  ///First node.
-  QueueNode head;
-  ///Last node.
-  QueueNode last;
+  ///Capacity of this queue (a power of two).
+  int capacity;
+  ///Position of the first element.
+  int head;
+  ///Buffer of this queue.
+  void** values;
 }SQueue;
 
 /**
@@ -157,4 +152,17 @@ int queueMap(Queue queue,void(*fun)(void*));
  */
 Iterator queueIterator(Queue queue);
 
+/**
+ * Creates a lazy iterator from a queue.
+ *
+ * @see LazyIt
+ *
+ * @param queue the queue
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt queueLazy(Queue queue);
+
 #endif
@@ -0,0 +1,364 @@
+/**
+ * Implementation of an indexable skip list.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file skiplist.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include "skiplist.h"
+
+/**
+ * Creates a node with the specified number of levels.
+ *
+ * @param height the number of levels
+ * @param value  the value of the node
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new node otherwise
+ */
+static SkipNode skipNewNode(int height,void* value)
+{
+  int i;
+  SkipNode node=malloc(sizeof(SSkipNode)+height*sizeof(SSkipLink));
+  if(node)
+  {
+    node->value=value;
+    node->height=height;
+    for(i=0;i<height;i++)
+    {
+      node->links[i].next=NULL;
+      node->links[i].width=0;
+    }
+  }
+  return node;
+}
+
+//==============================================================================
+
+SkipList newSkipList(void)
+{
+  SkipList list=malloc(sizeof(SSkipList));
+  if(list)
+  {
+    list->head=skipNewNode(SKIP_LEVELS,NULL);
+    if(!list->head)
+    {
+      free(list);
+      list=NULL;
+    }
+    else
+    {
+      list->size=0;
+      list->level=1;
+      list->seed=2463534242u;
+      list->last=NULL;
+    }
+  }
+  return list;
+}
+
+//==============================================================================
+
+void skipDelete(SkipList list)
+{
+  SkipNode this,next;
+  for(this=list->head;this;this=next)
+  {
+    next=this->links[0].next;
+    free(this);
+  }
+  free(list);
+}
+
+//==============================================================================
+
+/**
+ * Chooses the number of levels of a new node.
+ *
+ * Each additional level is chosen with probability 1/4, using a xorshift
+ * generator.
+ *
+ * @param list the list
+ *
+ * @return
+ * the number of levels
+ */
+static int skipHeight(SkipList list)
+{
+  int height=1;
+  unsigned int x=list->seed;
+  x^=x<<13;
+  x^=x>>17;
+  x^=x<<5;
+  list->seed=x;
+  for(;height<SKIP_LEVELS&&!(x&3);x>>=2) height++;
+  return height;
+}
+
+//==============================================================================
+
+/**
+ * Finds, at each level, the last node before a position of a skip list.
+ *
+ * Positions are counted from the head node (position 0), so the element at
+ * index <tt>i</tt> is at position <tt>i+1</tt>.
+ *
+ * @param list   the list
+ * @param pos    the position
+ * @param update array where the node found at each level will be put
+ * @param at     array where the position of each of those nodes will be put
+ */
+static void skipFind(SkipList list,int pos,SkipNode* update,int* at)
+{
+  int l,cur=0;
+  SkipNode aux=list->head;
+  for(l=list->level-1;l>=0;l--)
+  {
+    while(aux->links[l].next&&cur+aux->links[l].width<pos)
+    {
+      cur+=aux->links[l].width;
+      aux=aux->links[l].next;
+    }
+    update[l]=aux;
+    at[l]=cur;
+  }
+}
+
+//==============================================================================
+
+int skipInsertFst(SkipList list,void* value)
+{
+  return skipInsertAt(list,0,value)?1:0;
+}
+
+//==============================================================================
+
+int skipInsertLst(SkipList list,void* value)
+{
+  return skipInsertAt(list,list->size,value)?1:0;
+}
+
+//==============================================================================
+
+int skipInsertAt(SkipList list,int index,void* value)
+{
+  int l,height,result=0,at[SKIP_LEVELS];
+  SkipNode new,update[SKIP_LEVELS];
+  if(index<0||index>list->size) result=1;
+  else
+  {
+    height=skipHeight(list);
+    new=skipNewNode(height,value);
+    if(!new) result=2;
+    else
+    {
+      for(l=list->level;l<height;l++)
+      {
+        list->head->links[l].next=NULL;
+        list->head->links[l].width=0;
+      }
+      if(height>list->level) list->level=height;
+      skipFind(list,index+1,update,at);
+      for(l=0;l<list->level;l++)
+      {
+        if(l<height)
+        {
+          new->links[l].next=update[l]->links[l].next;
+          if(new->links[l].next)
+            new->links[l].width=update[l]->links[l].width-(index-at[l]);
+          update[l]->links[l].next=new;
+          update[l]->links[l].width=index+1-at[l];
+        }
+        else if(update[l]->links[l].next) update[l]->links[l].width++;
+      }
+      if(!new->links[0].next) list->last=new;
+      list->size++;
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+int skipRemoveFst(SkipList list,void** value)
+{
+  return skipRemoveAt(list,0,value);
+}
+
+//==============================================================================
+
+int skipRemoveLst(SkipList list,void** value)
+{
+  return skipRemoveAt(list,list->size-1,value);
+}
+
+//==============================================================================
+
+int skipRemoveAt(SkipList list,int index,void** value)
+{
+  int l,result=0,at[SKIP_LEVELS];
+  SkipNode node,update[SKIP_LEVELS];
+  if(index<0||index>list->size-1)
+  {
+    if(value) *value=NULL;
+    result=1;
+  }
+  else
+  {
+    skipFind(list,index+1,update,at);
+    node=update[0]->links[0].next;
+    if(value) *value=node->value;
+    for(l=0;l<list->level;l++)
+    {
+      if(update[l]->links[l].next==node)
+      {
+        update[l]->links[l].next=node->links[l].next;
+        if(node->links[l].next)
+          update[l]->links[l].width+=node->links[l].width-1;
+        else update[l]->links[l].width=0;
+      }
+      else if(update[l]->links[l].next) update[l]->links[l].width--;
+    }
+    if(list->last==node)
+      list->last=update[0]==list->head?NULL:update[0];
+    while(list->level>1&&!list->head->links[list->level-1].next)
+      list->level--;
+    free(node);
+    list->size--;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int skipFst(SkipList list,void** value)
+{
+  int result=0;
+  if(!list->size)
+  {
+    *value=NULL;
+    result=1;
+  }
+  else *value=list->head->links[0].next->value;
+  return result;
+}
+
+//==============================================================================
+
+int skipLst(SkipList list,void** value)
+{
+  int result=0;
+  if(!list->size)
+  {
+    *value=NULL;
+    result=1;
+  }
+  else *value=list->last->value;
+  return result;
+}
+
+//==============================================================================
+
+int skipAt(SkipList list,int index,void** value)
+{
+  int l,cur=0,result=0;
+  SkipNode aux=list->head;
+  if(index<0||index>list->size-1)
+  {
+    *value=NULL;
+    result=1;
+  }
+  else
+  {
+    for(l=list->level-1;l>=0;l--)
+    {
+      while(aux->links[l].next&&cur+aux->links[l].width<=index+1)
+      {
+        cur+=aux->links[l].width;
+        aux=aux->links[l].next;
+      }
+    }
+    *value=aux->value;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int skipSize(SkipList list)
+{
+  return list->size;
+}
+
+//==============================================================================
+
+int skipMap(SkipList list,void(*fun)(void*))
+{
+  int result=0;
+  SkipNode aux;
+  if(!list->size) result=1;
+  else
+  {
+    for(aux=list->head->links[0].next;aux;aux=aux->links[0].next)
+      fun(aux->value);
+  }
+  return result;
+}
+
+//==============================================================================
+
+Iterator skipIterator(SkipList list)
+{
+  int ctrl=0;
+  SkipNode aux;
+  Iterator it;
+  it=newIt(list->size);
+  if(it)
+  {
+    for(aux=list->head->links[0].next;aux&&!ctrl;aux=aux->links[0].next)
+      ctrl=itAdd(it,aux->value);
+    if(ctrl)
+    {
+      itDelete(it);
+      it=NULL;
+    }
+  }
+  return it;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator over a skip list.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int skipLazyNext(LazyIt it,void** val)
+{
+  int result=0;
+  SkipNode aux=it->state[0];
+  if(!aux) result=1;
+  else
+  {
+    *val=aux->value;
+    it->state[0]=aux->links[0].next;
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt skipLazy(SkipList list)
+{
+  LazyIt it=newLazy(skipLazyNext,NULL);
+  if(it) it->state[0]=list->head->links[0].next;
+  return it;
+}
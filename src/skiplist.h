@@ -0,0 +1,297 @@
+/**
+ * Implementation of an indexable skip list.
+ *
+ * Provides functions to create and manipulate a sequence of elements, with the
+ * same API as <tt>@ref List</tt>, where accessing, inserting or removing an
+ * element at any position takes O(log n) expected time (instead of O(n)).
+ *
+ * Each node is linked to the following nodes at several levels (a node has
+ * <i>k</i> levels with probability 1/4<sup><i>k</i>-1</sup>), and each link
+ * records how many positions it skips, so that a position can be found by
+ * following the links from the highest level down.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file skiplist.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _SKIPLIST_H_
+#define _SKIPLIST_H_
+
+#include "iterator.h"
+#include "lazyit.h"
+
+/**
+ * Maximum number of levels of a skip list.
+ */
+#define SKIP_LEVELS 16
+
+/**
+ * Skip list link structure.
+ */
+typedef struct sSkipLink
+{
+  ///Next node at this level.
+  struct sSkipNode* next;
+  ///Number of positions between this node and the next one at this level.
+  int width;
+}SSkipLink;
+
+/**
+ * Skip list node structure.
+ */
+typedef struct sSkipNode
+{
+  ///Node's value.
+  void* value;
+  ///Number of levels of this node.
+  int height;
+  ///Links to the next nodes (one for each level).
+  SSkipLink links[];
+}SSkipNode;
+
+/**
+ * Skip list node definition.
+ */
+typedef SSkipNode* SkipNode;
+
+/**
+ * Skip list structure.
+ */
+typedef struct sSkipList
+{
+  ///Number of elements of this list.
+  int size;
+  ///Number of levels in use.
+  int level;
+  ///State of the random number generator used to choose the node levels.
+  unsigned int seed;
+  ///Head node (which does not hold an element).
+  SkipNode head;
+  ///Last node.
+  SkipNode last;
+}SSkipList;
+
+/**
+ * Skip list definition.
+ */
+typedef SSkipList* SkipList;
+
+//==============================================================================
+
+/**
+ * Creates a skip list.
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new list otherwise
+ */
+SkipList newSkipList(void);
+
+/**
+ * Deletes a skip list.
+ *
+ * @attention
+ * This function only frees the memory used by the list.  It does not free the
+ * memory used by elements the list contains.
+ *
+ * @param list the list to be deleted
+ */
+void skipDelete(SkipList list);
+
+/**
+ * Inserts an element at the beginning of a skip list.
+ *
+ * @param list  the list
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if it was not possible to insert the new element
+ */
+int skipInsertFst(SkipList list,void* value);
+
+/**
+ * Inserts an element at the end of a skip list.
+ *
+ * @param list  the list
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if it was not possible to insert the new element
+ */
+int skipInsertLst(SkipList list,void* value);
+
+/**
+ * Inserts an new element at the specified position of a skip list.
+ *
+ * The position, specified by argument <tt>index</tt>, must be a non negative
+ * integer, and not greater than the current size of the list.
+ *
+ * @param list  the list
+ * @param index the index at which the new value is to be inserted
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if the position was not valid\n
+ * 2 if it was not possible to insert the new element
+ */
+int skipInsertAt(SkipList list,int index,void* value);
+
+/**
+ * Removes the first element of a skip list.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param list  the list.
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the list was empty
+ */
+int skipRemoveFst(SkipList list,void** value);
+
+/**
+ * Removes the last element of a skip list.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param list  the list.
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the list was empty
+ */
+int skipRemoveLst(SkipList list,void** value);
+
+/**
+ * Removes the element at the specified position of a skip list.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param list  the list.
+ * @param index the index of the element to be removed
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the value of <tt>index</tt> was invalid
+ */
+int skipRemoveAt(SkipList list,int index,void** value);
+
+/**
+ * Provides the value at the first position of a skip list.
+ *
+ * If the list is empty, it will be put the value <tt>NULL</tt> at
+ * <tt>value</tt>.
+ *
+ * @param list  the list
+ * @param value pointer where the value at the first position will be put
+ *
+ * @return
+ * 0 if the list was not empty\n
+ * 1 otherwise
+ */
+int skipFst(SkipList list,void** value);
+
+/**
+ * Provides the value at the last position of a skip list.
+ *
+ * If the list is empty, it will be put the value <tt>NULL</tt> at
+ * <tt>value</tt>.
+ *
+ * @param list  the list
+ * @param value pointer where the value at the last position will be put
+ *
+ * @return
+ * 0 if the list was not empty\n
+ * 1 otherwise
+ */
+int skipLst(SkipList list,void** value);
+
+/**
+ * Provides the element at the specified position of a skip list.
+ *
+ * If there is no element at the specified position, it will be put the value
+ * <tt>NULL</tt> at <tt>value</tt>.
+ *
+ * @param list  the list
+ * @param index the index of the element to be provided
+ * @param value pointer where the value at the specified position will be put
+ *
+ * @return
+ * 0 if there was an elements at the specified position\n
+ * 1 otherwise
+ */
+int skipAt(SkipList list,int index,void** value);
+
+/**
+ * Returns the size of a skip list.
+ *
+ * @param list the list
+ *
+ * @return
+ * the size of the list
+ */
+int skipSize(SkipList list);
+
+/**
+ * Applies a function to the elements of a skip list.
+ *
+ * The function to be applied must be of type <tt>void fun(void*)</tt>.
+ *
+ * @param list the list
+ * @param fun  the function to be applied
+ *
+ * @return
+ * 0 if the list was not empty\n
+ * 1 otherwise
+ */
+int skipMap(SkipList list,void(*fun)(void*));
+
+/**
+ * Creates an iterator from a skip list.
+ *
+ * @see Iterator
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator skipIterator(SkipList list);
+
+/**
+ * Creates a lazy iterator from a skip list.
+ *
+ * @see LazyIt
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt skipLazy(SkipList list);
+
+#endif
@@ -0,0 +1,194 @@
+/**
+ * Implementation of a lock-free single-producer/single-consumer queue.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file spscqueue.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "spscqueue.h"
+
+SPSCQueue newSPSCQueue(int capacity)
+{
+  size_t size=1;
+  SPSCQueue queue=NULL;
+  if(capacity>0&&capacity<=1<<30)
+  {
+    for(;size<(size_t)capacity;size<<=1);
+    queue=aligned_alloc(SPSC_LINE,sizeof(SSPSCQueue));
+    if(queue)
+    {
+      queue->values=malloc(size*sizeof(void*));
+      if(!queue->values)
+      {
+        free(queue);
+        queue=NULL;
+      }
+      else
+      {
+        atomic_init(&queue->tail,0);
+        atomic_init(&queue->head,0);
+        queue->headCache=0;
+        queue->tailCache=0;
+        queue->mask=size-1;
+      }
+    }
+  }
+  return queue;
+}
+
+//==============================================================================
+
+void spscDelete(SPSCQueue queue)
+{
+  free(queue->values);
+  free(queue);
+}
+
+//==============================================================================
+
+/**
+ * Copies values to or from the buffer of a single-producer/single-consumer
+ * queue, wrapping around the end of the buffer.
+ *
+ * @param queue  the queue
+ * @param pos    the position of the buffer where the copy starts
+ * @param values the array of values
+ * @param n      the number of values
+ * @param in     specifies whether values are copied into the buffer
+ * (<tt>in!=0</tt>) or out of it
+ */
+static void spscCopy(SPSCQueue queue,size_t pos,void** values,int n,int in)
+{
+  size_t start=pos&queue->mask;
+  size_t fst=queue->mask+1-start;
+  if(fst>(size_t)n) fst=n;
+  if(in)
+  {
+    memcpy(queue->values+start,values,fst*sizeof(void*));
+    memcpy(queue->values,values+fst,(n-fst)*sizeof(void*));
+  }
+  else
+  {
+    memcpy(values,queue->values+start,fst*sizeof(void*));
+    memcpy(values+fst,queue->values,(n-fst)*sizeof(void*));
+  }
+}
+
+//==============================================================================
+
+int spscInsert(SPSCQueue queue,void* value)
+{
+  int result=0;
+  size_t tail=atomic_load_explicit(&queue->tail,memory_order_relaxed);
+  if(tail-queue->headCache>queue->mask)
+  {
+    queue->headCache=atomic_load_explicit(&queue->head,memory_order_acquire);
+    if(tail-queue->headCache>queue->mask) result=1;
+  }
+  if(!result)
+  {
+    queue->values[tail&queue->mask]=value;
+    atomic_store_explicit(&queue->tail,tail+1,memory_order_release);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int spscInsertBatch(SPSCQueue queue,void** values,int n)
+{
+  int room;
+  size_t tail=atomic_load_explicit(&queue->tail,memory_order_relaxed);
+  room=(int)(queue->mask+1-(tail-queue->headCache));
+  if(room<n)
+  {
+    queue->headCache=atomic_load_explicit(&queue->head,memory_order_acquire);
+    room=(int)(queue->mask+1-(tail-queue->headCache));
+    if(room<n) n=room;
+  }
+  if(n>0)
+  {
+    spscCopy(queue,tail,values,n,1);
+    atomic_store_explicit(&queue->tail,tail+n,memory_order_release);
+  }
+  return n>0?n:0;
+}
+
+//==============================================================================
+
+int spscRemove(SPSCQueue queue,void** value)
+{
+  int result=0;
+  size_t head=atomic_load_explicit(&queue->head,memory_order_relaxed);
+  if(head==queue->tailCache)
+  {
+    queue->tailCache=atomic_load_explicit(&queue->tail,memory_order_acquire);
+    if(head==queue->tailCache) result=1;
+  }
+  if(result)
+  {
+    if(value) *value=NULL;
+  }
+  else
+  {
+    if(value) *value=queue->values[head&queue->mask];
+    atomic_store_explicit(&queue->head,head+1,memory_order_release);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int spscRemoveBatch(SPSCQueue queue,void** values,int max)
+{
+  int avail;
+  size_t head=atomic_load_explicit(&queue->head,memory_order_relaxed);
+  avail=(int)(queue->tailCache-head);
+  if(avail<max)
+  {
+    queue->tailCache=atomic_load_explicit(&queue->tail,memory_order_acquire);
+    avail=(int)(queue->tailCache-head);
+    if(avail<max) max=avail;
+  }
+  if(max>0)
+  {
+    spscCopy(queue,head,values,max,0);
+    atomic_store_explicit(&queue->head,head+max,memory_order_release);
+  }
+  return max>0?max:0;
+}
+
+//==============================================================================
+
+int spscConsult(SPSCQueue queue,void** value)
+{
+  int result=0;
+  size_t head=atomic_load_explicit(&queue->head,memory_order_relaxed);
+  if(head==queue->tailCache)
+  {
+    queue->tailCache=atomic_load_explicit(&queue->tail,memory_order_acquire);
+    if(head==queue->tailCache) result=1;
+  }
+  if(result) *value=NULL;
+  else *value=queue->values[head&queue->mask];
+  return result;
+}
+
+//==============================================================================
+
+int spscSize(SPSCQueue queue)
+{
+  size_t head=atomic_load_explicit(&queue->head,memory_order_acquire);
+  size_t size=atomic_load_explicit(&queue->tail,memory_order_acquire)-head;
+  return size>queue->mask?(int)(queue->mask+1):(int)size;
+}
+
+//==============================================================================
+
+int spscCapacity(SPSCQueue queue)
+{
+  return (int)(queue->mask+1);
+}
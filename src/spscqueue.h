@@ -0,0 +1,183 @@
+/**
+ * Implementation of a lock-free single-producer/single-consumer queue.
+ *
+ * Provides functions to create and manipulate a bounded queue that can be used
+ * by one producer thread and one consumer thread at the same time, without
+ * locks.  Inserting and removing elements are wait-free operations.
+ *
+ * The elements are stored in a circular buffer whose capacity is a power of
+ * two.  The positions written by the producer and by the consumer are kept in
+ * different cache lines, and each thread keeps a cached copy of the position of
+ * the other thread, which is only refreshed when the queue seems full (or
+ * empty), so that the threads rarely touch each other's cache line.
+ *
+ * Requires C11 atomics (<tt>stdatomic.h</tt>).
+ *
+ * @attention
+ * Functions <tt>@ref spscInsert</tt> and <tt>@ref spscInsertBatch</tt> must
+ * only be called by the producer, and functions <tt>@ref spscRemove</tt>,
+ * <tt>@ref spscRemoveBatch</tt> and <tt>@ref spscConsult</tt> must only be
+ * called by the consumer.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file spscqueue.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _SPSCQUEUE_H_
+#define _SPSCQUEUE_H_
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/**
+ * Size of a cache line (in bytes).
+ */
+#define SPSC_LINE 64
+
+/**
+ * Single-producer/single-consumer queue structure.
+ */
+typedef struct sSPSCQueue
+{
+  ///Position where the next element will be inserted (written by the
+  ///producer).
+  _Alignas(SPSC_LINE) atomic_size_t tail;
+  ///Producer's copy of the position of the first element.
+  size_t headCache;
+  ///Position of the first element (written by the consumer).
+  _Alignas(SPSC_LINE) atomic_size_t head;
+  ///Consumer's copy of the position where the next element will be inserted.
+  size_t tailCache;
+  ///Capacity of this queue minus 1 (the capacity is a power of two).
+  _Alignas(SPSC_LINE) size_t mask;
+  ///Buffer of this queue.
+  void** values;
+}SSPSCQueue;
+
+/**
+ * Single-producer/single-consumer queue definition.
+ */
+typedef SSPSCQueue* SPSCQueue;
+
+//==============================================================================
+
+/**
+ * Creates a single-producer/single-consumer queue.
+ *
+ * The capacity must be a positive number, and it is rounded up to a power of
+ * two.
+ *
+ * @param capacity the capacity of the queue
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new queue otherwise
+ */
+SPSCQueue newSPSCQueue(int capacity);
+
+/**
+ * Deletes a single-producer/single-consumer queue.
+ *
+ * @attention
+ * This function only frees the memory used by the queue.  It does not free the
+ * memory used by elements the queue contains.
+ *
+ * @param queue the queue to be deleted
+ */
+void spscDelete(SPSCQueue queue);
+
+/**
+ * Inserts an element in a single-producer/single-consumer queue.
+ *
+ * @param queue the queue
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if the queue was full
+ */
+int spscInsert(SPSCQueue queue,void* value);
+
+/**
+ * Inserts several elements in a single-producer/single-consumer queue.
+ *
+ * Inserts as many of the <tt>n</tt> values as there is room for, and makes all
+ * of them visible to the consumer at once.
+ *
+ * @param queue  the queue
+ * @param values the values to be inserted
+ * @param n      the number of values
+ *
+ * @return
+ * the number of values inserted
+ */
+int spscInsertBatch(SPSCQueue queue,void** values,int n);
+
+/**
+ * Removes an element from a single-producer/single-consumer queue.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @param queue the queue
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 if the queue was empty
+ */
+int spscRemove(SPSCQueue queue,void** value);
+
+/**
+ * Removes several elements from a single-producer/single-consumer queue.
+ *
+ * @param queue  the queue
+ * @param values array where the removed values will be put
+ * @param max    the maximum number of values to be removed
+ *
+ * @return
+ * the number of values removed
+ */
+int spscRemoveBatch(SPSCQueue queue,void** values,int max);
+
+/**
+ * Provides the value at the head of a single-producer/single-consumer queue.
+ *
+ * If the queue is empty, it will be put the value <tt>NULL</tt> at
+ * <tt>value</tt>.
+ *
+ * @param queue the queue
+ * @param value pointer where the value at the head will be put
+ *
+ * @return
+ * 0 if the queue was not empty\n
+ * 1 otherwise
+ */
+int spscConsult(SPSCQueue queue,void** value);
+
+/**
+ * Returns the approximate size of a single-producer/single-consumer queue.
+ *
+ * The size may be outdated as soon as it is returned, when the queue is being
+ * used by other threads.
+ *
+ * @param queue the queue
+ *
+ * @return
+ * the approximate size of the queue
+ */
+int spscSize(SPSCQueue queue);
+
+/**
+ * Returns the capacity of a single-producer/single-consumer queue.
+ *
+ * @param queue the queue
+ *
+ * @return
+ * the capacity of the queue
+ */
+int spscCapacity(SPSCQueue queue);
+
+#endif
@@ -1,12 +1,14 @@
 /**
- * Implementation of a stack as a linked list.
+ * Implementation of a stack as a list of chunks.
  *
  * @author Rui Carlos Gonçalves
  * @file stack.c
  * @version 3.0.1
  * @date 01/2014
  */
+#include <limits.h>
 #include <stdlib.h>
+#include <string.h>
 #include "stack.h"
 
 
@@ -16,26 +18,88 @@ Stack newStack(void)
   if(stack)
   {
     stack->size=0;
+    stack->used=0;
     stack->top=NULL;
+    stack->spare=NULL;
   }
   return stack;
 }
 
 //==============================================================================
 
+/**
+ * Frees a list of stack chunks.
+ *
+ * @param chunk the first chunk
+ */
+static void stackFree(StackChunk chunk)
+{
+  StackChunk aux;
+  while(chunk)
+  {
+    aux=chunk;
+    chunk=chunk->next;
+    free(aux);
+  }
+}
+
+//==============================================================================
+
 void stackDelete(Stack stack)
 {
-  StackNode aux1,aux2;
-  if(stack->size) free(stack);
+  stackFree(stack->top);
+  stackFree(stack->spare);
+  free(stack);
+}
+
+//==============================================================================
+
+/**
+ * Puts a new empty chunk at the top of a stack, reusing a spare chunk if there
+ * is one.
+ *
+ * @param stack the stack
+ *
+ * @return
+ * 0 if the new chunk was put at the top\n
+ * 1 if it was not possible to allocate memory
+ */
+static int stackGrow(Stack stack)
+{
+  int result=0;
+  StackChunk chunk=stack->spare;
+  if(chunk) stack->spare=chunk->next;
+  else chunk=malloc(sizeof(SStackChunk));
+  if(!chunk) result=1;
   else
   {
-    for(aux1=stack->top;aux1;)
-    {
-      aux2=aux1;
-      aux1=aux1->next;
-      free(aux2);
-    }
-    free(stack);
+    chunk->next=stack->top;
+    stack->top=chunk;
+    stack->used=0;
+  }
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Removes the (empty) chunk at the top of a stack.
+ *
+ * The chunk is kept as a spare if there is no other spare chunk, so that
+ * pushing and popping around a chunk boundary does not allocate memory.
+ *
+ * @param stack the stack
+ */
+static void stackShrink(Stack stack)
+{
+  StackChunk chunk=stack->top;
+  stack->top=chunk->next;
+  stack->used=stack->top?STACK_CHUNK:0;
+  if(stack->spare) free(chunk);
+  else
+  {
+    chunk->next=NULL;
+    stack->spare=chunk;
   }
 }
 
@@ -44,16 +108,12 @@ void stackDelete(Stack stack)
 int stackPush(Stack stack,void* value)
 {
   int result=0;
-  StackNode new;
-  new=malloc(sizeof(SStackNode));
-  if(new)
+  if((!stack->top||stack->used==STACK_CHUNK)&&stackGrow(stack)) result=1;
+  else
   {
+    stack->top->values[stack->used++]=value;
     stack->size++;
-    new->value=value;
-    new->next=stack->top;
-    stack->top=new;
   }
-  else result=1;
   return result;
 }
 
@@ -62,7 +122,6 @@ int stackPush(Stack stack,void* value)
 int stackPop(Stack stack,void** value)
 {
   int result=0;
-  StackNode aux;
   if(!stack->size)
   {
     if(value) *value=NULL;
@@ -70,11 +129,74 @@ int stackPop(Stack stack,void** value)
   }
   else
   {
-    if(value) *value=stack->top->value;
-    aux=stack->top;
-    stack->top=stack->top->next;
-    free(aux);
+    stack->used--;
+    if(value) *value=stack->top->values[stack->used];
     stack->size--;
+    if(!stack->used) stackShrink(stack);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int stackPushBatch(Stack stack,void** values,int n)
+{
+  int count,result=0;
+  if(n>0)
+  {
+    if(n>INT_MAX-stack->size||stackReserve(stack,stack->size+n)) result=1;
+    else
+    {
+      while(n)
+      {
+        if(!stack->top||stack->used==STACK_CHUNK) stackGrow(stack);
+        count=STACK_CHUNK-stack->used<n?STACK_CHUNK-stack->used:n;
+        memcpy(stack->top->values+stack->used,values,count*sizeof(void*));
+        stack->used+=count;
+        stack->size+=count;
+        values+=count;
+        n-=count;
+      }
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+int stackPopBatch(Stack stack,void** values,int max)
+{
+  int i,n=0;
+  while(n<max&&stack->size)
+  {
+    for(i=stack->used-1;i>=0&&n<max;i--,n++)
+      values[n]=stack->top->values[i];
+    stack->size-=stack->used-1-i;
+    stack->used=i+1;
+    if(!stack->used) stackShrink(stack);
+  }
+  return n;
+}
+
+//==============================================================================
+
+int stackReserve(Stack stack,int capacity)
+{
+  int room,result=0;
+  StackChunk chunk;
+  room=stack->top?STACK_CHUNK-stack->used:0;
+  for(chunk=stack->spare;chunk&&room<capacity-stack->size;chunk=chunk->next)
+    room+=STACK_CHUNK;
+  while(room<capacity-stack->size&&!result)
+  {
+    chunk=malloc(sizeof(SStackChunk));
+    if(!chunk) result=1;
+    else
+    {
+      chunk->next=stack->spare;
+      stack->spare=chunk;
+      room+=STACK_CHUNK;
+    }
   }
   return result;
 }
@@ -89,7 +211,7 @@ int stackTop(Stack stack,void** value)
     *value=NULL;
     result=1;
   }
-  else *value=stack->top->value;
+  else *value=stack->top->values[stack->used-1];
   return result;
 }
 
@@ -104,14 +226,14 @@ int stackSize(Stack stack)
 
 int stackMap(Stack stack,void(*fun)(void*))
 {
-  int result=0;
-  StackNode aux;
+  int i,result=0;
+  StackChunk aux;
   if(!stack->size) result=1;
   else
   {
-    for(aux=stack->top;aux;aux=aux->next)
+    for(aux=stack->top,i=stack->used;aux;aux=aux->next,i=STACK_CHUNK)
     {
-      fun(aux->value);
+      while(i) fun(aux->values[--i]);
     }
   }
   return result;
@@ -121,13 +243,14 @@ int stackMap(Stack stack,void(*fun)(void*))
 
 Iterator stackIterator(Stack stack)
 {
-  int ctrl;
-  StackNode aux;
+  int i,ctrl;
+  StackChunk aux;
   Iterator it;
   it=newIt(stack->size);
-  for(aux=stack->top,ctrl=0;aux&&!ctrl;aux=aux->next)
+  for(aux=stack->top,i=stack->used,ctrl=0;aux&&!ctrl;
+      aux=aux->next,i=STACK_CHUNK)
   {
-    ctrl=itAdd(it,aux->value);
+    while(i&&!ctrl) ctrl=itAdd(it,aux->values[--i]);
   }
   if(ctrl)
   {
@@ -136,3 +259,50 @@ Iterator stackIterator(Stack stack)
   }
   return it;
 }
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator over a stack.
+ *
+ * The state of the iterator is the current chunk, and the number of elements
+ * of that chunk that were not provided yet.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int stackLazyNext(LazyIt it,void** val)
+{
+  int result=0;
+  StackChunk aux=it->state[0];
+  if(aux&&!it->index[0])
+  {
+    aux=aux->next;
+    it->state[0]=aux;
+    it->index[0]=STACK_CHUNK;
+  }
+  if(!aux) result=1;
+  else
+  {
+    it->index[0]--;
+    *val=aux->values[it->index[0]];
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt stackLazy(Stack stack)
+{
+  LazyIt it=newLazy(stackLazyNext,NULL);
+  if(it)
+  {
+    it->state[0]=stack->top;
+    it->index[0]=stack->used;
+  }
+  return it;
+}
@@ -1,8 +1,14 @@
 /**
- * Implementation of a stack as a linked list.
+ * Implementation of a stack as a list of chunks.
  *
  * Provides functions to create and manipulate stacks.
  *
+ * The elements are stored in fixed-size chunks of <tt>@ref STACK_CHUNK</tt>
+ * elements, linked from the top of the stack to the bottom, so that growing
+ * the stack never copies elements.  A chunk that becomes empty is kept as a
+ * spare, so that pushing and popping around a chunk boundary does not allocate
+ * memory.
+ *
  * @author Rui Carlos Gonçalves
  * @file stack.h
  * @version 3.0.1
@@ -12,22 +18,28 @@
 #define _STACK_H_
 
 #include "iterator.h"
+#include "lazyit.h"
 
 /**
- * Stack node structure.
+ * Number of elements of each chunk of a stack.
  */
-typedef struct sStackNode
+#define STACK_CHUNK 256
+
+/**
+ * Stack chunk structure.
+ */
+typedef struct sStackChunk
 {
-  ///Node's value.
-  void* value;
-  ///Next node.
-  struct sStackNode *next;
-}SStackNode;
+  ///Next chunk (towards the bottom of the stack).
+  struct sStackChunk* next;
+  ///Chunk's values.
+  void* values[STACK_CHUNK];
+}SStackChunk;
 
 /**
- * Stack node definition.
+ * Stack chunk definition.
  */
-typedef SStackNode* StackNode;
+typedef SStackChunk* StackChunk;
 
 /**
  * Stack structure.
@@ -36,8 +48,12 @@ typedef struct sStack
 {
   ///Number of values of this stack.
   int size;
-  ///Top node of this stack.
-  StackNode top;
+  ///Number of values in the top chunk of this stack.
+  int used;
+  ///Top chunk of this stack.
+  StackChunk top;
+  ///Spare chunks of this stack.
+  StackChunk spare;
 }SStack;
 
 /**
@@ -98,6 +114,53 @@ int stackPush(Stack stack,void* value);
  */
 int stackPop(Stack stack,void** value);
 
+/**
+ * Inserts several elements at the top of a stack.
+ *
+ * The elements are pushed in order, so <tt>values[n-1]</tt> becomes the top of
+ * the stack.  Either all the elements are inserted, or none is.
+ *
+ * @param stack  the stack
+ * @param values the values to be inserted
+ * @param n      the number of values
+ *
+ * @return
+ * 0 if the new values were inserted\n
+ * 1 if it was not possible to insert the new elements
+ */
+int stackPushBatch(Stack stack,void** values,int n);
+
+/**
+ * Removes several elements from the top of a stack.
+ *
+ * The elements are removed in order, so <tt>values[0]</tt> is the element
+ * that was at the top of the stack.
+ *
+ * @attention
+ * This function does not free the memory used by the removed elements.
+ *
+ * @param stack  the stack
+ * @param values array where the removed values will be put
+ * @param max    the maximum number of values to be removed
+ *
+ * @return
+ * the number of values removed
+ */
+int stackPopBatch(Stack stack,void** values,int max);
+
+/**
+ * Ensures that a stack can hold the specified number of elements without
+ * allocating memory.
+ *
+ * @param stack    the stack
+ * @param capacity the required capacity
+ *
+ * @return
+ * 0 if the stack can hold <tt>capacity</tt> elements\n
+ * 1 if it was not possible to allocate memory
+ */
+int stackReserve(Stack stack,int capacity);
+
 /**
  * Provides the value of the element at the top of a stack.
  *
@@ -154,4 +217,17 @@ int stackMap(Stack stack,void(*fun)(void*));
  */
 Iterator stackIterator(Stack stack);
 
+/**
+ * Creates a lazy iterator from a stack.
+ *
+ * @see LazyIt
+ *
+ * @param stack the stack
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt stackLazy(Stack stack);
+
 #endif
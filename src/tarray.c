@@ -0,0 +1,247 @@
+/**
+ * Implementation of a typed array (dense dynamic array of values).
+ *
+ * @author Rui Carlos Gonçalves
+ * @file tarray.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tarray.h"
+
+/**
+ * Given a typed array (<tt>A</tt>) and a position (<tt>I</tt>), provides a
+ * pointer to the element at that position.
+ */
+#define ELEM(A,I) ((char*)(A)->data+(size_t)(I)*(A)->elemSize)
+
+TArray newTArray(size_t elemSize,int capacity)
+{
+  TArray array=NULL;
+  if(elemSize>0&&capacity>0)
+  {
+    array=malloc(sizeof(STArray));
+    if(array)
+    {
+      array->elemSize=elemSize;
+      array->capacity=capacity;
+      array->size=0;
+      array->data=malloc(capacity*elemSize);
+      if(!array->data)
+      {
+        free(array);
+        array=NULL;
+      }
+    }
+  }
+  return array;
+}
+
+//==============================================================================
+
+void tarrayDelete(TArray array)
+{
+  free(array->data);
+  free(array);
+}
+
+//==============================================================================
+
+/**
+ * Changes the capacity of a typed array.
+ *
+ * @param array    the array
+ * @param capacity the new capacity (not less than the size of the array)
+ *
+ * @return
+ * 0 if the capacity was changed\n
+ * 1 otherwise
+ */
+static int tarrayRealloc(TArray array,int capacity)
+{
+  int result=0;
+  void* newdata=realloc(array->data,capacity*array->elemSize);
+  if(!newdata) result=1;
+  else
+  {
+    array->data=newdata;
+    array->capacity=capacity;
+  }
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Tells whether a pointer refers to the elements of a typed array, in which
+ * case it provides the offset of the pointed element.
+ *
+ * @param array  the array
+ * @param elem   the pointer
+ * @param offset pointer where the offset (in bytes) will be put
+ *
+ * @return
+ * 1 if the pointer refers to the elements of the array\n
+ * 0 otherwise
+ */
+static int tarrayInside(TArray array,const void* elem,size_t* offset)
+{
+  uintptr_t start=(uintptr_t)array->data,pos=(uintptr_t)elem;
+  *offset=(size_t)(pos-start);
+  return pos>=start&&*offset<(size_t)array->size*array->elemSize;
+}
+
+//==============================================================================
+
+/**
+ * Ensures that a typed array has room for one more element, doubling its
+ * capacity if needed.
+ *
+ * If <tt>elem</tt> refers to an element of the array, it is updated to refer
+ * to the same element after the array is moved.
+ *
+ * @param array the array
+ * @param elem  pointer to the element that will be inserted
+ *
+ * @return
+ * 0 if there is room for one more element\n
+ * 1 otherwise
+ */
+static int tarrayGrow(TArray array,const void** elem)
+{
+  int inside,result=0;
+  size_t offset;
+  if(array->size==array->capacity)
+  {
+    inside=tarrayInside(array,*elem,&offset);
+    if(array->capacity==INT_MAX) result=1;
+    else if(array->capacity>INT_MAX/2) result=tarrayRealloc(array,INT_MAX);
+    else result=tarrayRealloc(array,2*array->capacity);
+    if(!result&&inside) *elem=(char*)array->data+offset;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int tarrayPush(TArray array,const void* elem)
+{
+  int result=tarrayGrow(array,&elem);
+  if(!result)
+  {
+    memcpy(ELEM(array,array->size),elem,array->elemSize);
+    array->size++;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int tarrayPop(TArray array,void* elem)
+{
+  int result=0;
+  if(!array->size) result=1;
+  else
+  {
+    array->size--;
+    if(elem) memcpy(elem,ELEM(array,array->size),array->elemSize);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int tarrayInsertAt(TArray array,int index,const void* elem)
+{
+  int result=0;
+  size_t offset;
+  if(index<0||index>array->size) result=1;
+  else if(tarrayGrow(array,&elem)) result=2;
+  else
+  {
+    if(tarrayInside(array,elem,&offset)&&offset>=(size_t)index*array->elemSize)
+      elem=(const char*)elem+array->elemSize;
+    memmove(ELEM(array,index+1),ELEM(array,index),
+            (size_t)(array->size-index)*array->elemSize);
+    memcpy(ELEM(array,index),elem,array->elemSize);
+    array->size++;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int tarrayAt(TArray array,int index,void* elem)
+{
+  int result=0;
+  if(index<0||index>=array->size) result=1;
+  else memcpy(elem,ELEM(array,index),array->elemSize);
+  return result;
+}
+
+//==============================================================================
+
+int tarraySet(TArray array,int index,const void* elem)
+{
+  int result=0;
+  if(index<0||index>=array->size) result=1;
+  else memmove(ELEM(array,index),elem,array->elemSize);
+  return result;
+}
+
+//==============================================================================
+
+void* tarrayPtr(TArray array,int index)
+{
+  return index<0||index>=array->size?NULL:ELEM(array,index);
+}
+
+//==============================================================================
+
+int tarrayReserve(TArray array,int capacity)
+{
+  int result=0;
+  if(capacity>array->capacity) result=tarrayRealloc(array,capacity);
+  return result;
+}
+
+//==============================================================================
+
+int tarrayShrink(TArray array)
+{
+  int result=1;
+  int capacity=array->size?array->size:1;
+  if(capacity<array->capacity) result=tarrayRealloc(array,capacity);
+  return result;
+}
+
+//==============================================================================
+
+int tarraySize(TArray array)
+{
+  return array->size;
+}
+
+//==============================================================================
+
+void* tarrayData(TArray array)
+{
+  return array->data;
+}
+
+//==============================================================================
+
+int tarrayMap(TArray array,void(*fun)(void*))
+{
+  int i,result=0;
+  if(!array->size) result=1;
+  else
+  {
+    for(i=0;i<array->size;i++)
+      fun(ELEM(array,i));
+  }
+  return result;
+}
@@ -0,0 +1,238 @@
+/**
+ * Implementation of a typed array (dense dynamic array of values).
+ *
+ * Provides functions to create and manipulate an array that stores elements of
+ * a fixed size (e.g. <tt>int</tt>, <tt>double</tt>, or a structure) by value,
+ * in a single contiguous block of memory.  Elements are copied in and out of
+ * the array (as by <tt>memcpy</tt>), so no memory is allocated per element.
+ *
+ * Elements can be accessed with their type using macro
+ * <tt>@ref TARRAY_AT</tt>:
+ *
+ * \code
+TArray vals=newTArray(sizeof(double),16);
+double x=1.5;
+tarrayPush(vals,&x);
+TARRAY_AT(vals,double,0)*=2;
+ * \endcode
+ *
+ * @author Rui Carlos Gonçalves
+ * @file tarray.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _TARRAY_H_
+#define _TARRAY_H_
+
+#include <stddef.h>
+
+/**
+ * Given a typed array (<tt>A</tt>), the type of its elements (<tt>T</tt>), and
+ * a position (<tt>I</tt>), provides the element at that position as an lvalue
+ * of type <tt>T</tt>.
+ *
+ * @attention
+ * The position is not checked.
+ */
+#define TARRAY_AT(A,T,I) (((T*)(A)->data)[I])
+
+/**
+ * Typed array structure.
+ */
+typedef struct sTArray
+{
+  ///Size of each element of this array (in bytes).
+  size_t elemSize;
+  ///Current capacity of this array.
+  int capacity;
+  ///Number of elements of this array.
+  int size;
+  ///This array's elements.
+  void* data;
+}STArray;
+
+/**
+ * Typed array definition.
+ */
+typedef STArray* TArray;
+
+//==============================================================================
+
+/**
+ * Creates an empty typed array, with the specified element size and initial
+ * capacity.
+ *
+ * Both the element size and the initial capacity must be positive numbers.
+ *
+ * @param elemSize the size of each element (in bytes)
+ * @param capacity the initial capacity of the array
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new array otherwise
+ */
+TArray newTArray(size_t elemSize,int capacity);
+
+/**
+ * Deletes a typed array.
+ *
+ * @param array the array to be deleted
+ */
+void tarrayDelete(TArray array);
+
+/**
+ * Inserts a copy of an element at the end of a typed array.
+ *
+ * If necessary, the capacity of the array is doubled.  The element may be an
+ * element of the array (e.g. obtained with <tt>@ref tarrayPtr</tt>).
+ *
+ * @param array the array
+ * @param elem  pointer to the element to be inserted
+ *
+ * @return
+ * 0 if the new element was inserted\n
+ * 1 if it was not possible to increase the array capacity
+ */
+int tarrayPush(TArray array,const void* elem);
+
+/**
+ * Removes the last element of a typed array.
+ *
+ * Copies the removed element to <tt>elem</tt> if the value of <tt>elem</tt>
+ * is not <tt>NULL</tt>.
+ *
+ * @param array the array
+ * @param elem  pointer where the removed element should be copied (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the array was empty
+ */
+int tarrayPop(TArray array,void* elem);
+
+/**
+ * Inserts a copy of an element at the specified position of a typed array.
+ *
+ * The elements from that position onwards are moved one position forward.
+ * The position must be a non negative integer, and not greater than the size
+ * of the array.  The element may be an element of the array.
+ *
+ * @param array the array
+ * @param index the index at which the new element is to be inserted
+ * @param elem  pointer to the element to be inserted
+ *
+ * @return
+ * 0 if the new element was inserted\n
+ * 1 if the position was not valid\n
+ * 2 if it was not possible to increase the array capacity
+ */
+int tarrayInsertAt(TArray array,int index,const void* elem);
+
+/**
+ * Copies the element at the specified position of a typed array.
+ *
+ * @param array the array
+ * @param index the index of the element to be provided
+ * @param elem  pointer where the element should be copied
+ *
+ * @return
+ * 0 if there was an element at the specified position\n
+ * 1 otherwise
+ */
+int tarrayAt(TArray array,int index,void* elem);
+
+/**
+ * Replaces the element at the specified position of a typed array by a copy
+ * of another element.
+ *
+ * @param array the array
+ * @param index the index of the element to be replaced
+ * @param elem  pointer to the new element
+ *
+ * @return
+ * 0 if the element was replaced\n
+ * 1 if the position was not valid
+ */
+int tarraySet(TArray array,int index,const void* elem);
+
+/**
+ * Provides a pointer to the element at the specified position of a typed
+ * array.
+ *
+ * @attention
+ * The pointer becomes invalid when the capacity of the array changes.
+ *
+ * @param array the array
+ * @param index the index of the element
+ *
+ * @return
+ * <tt>NULL</tt> if the position was not valid\n
+ * a pointer to the element otherwise
+ */
+void* tarrayPtr(TArray array,int index);
+
+/**
+ * Ensures that a typed array can hold the specified number of elements without
+ * growing.
+ *
+ * @param array    the array
+ * @param capacity the required capacity
+ *
+ * @return
+ * 0 if the array can hold <tt>capacity</tt> elements\n
+ * 1 if it was not possible to increase the array capacity
+ */
+int tarrayReserve(TArray array,int capacity);
+
+/**
+ * Reduces the capacity of a typed array to its size (or to 1, if it is
+ * empty).
+ *
+ * @param array the array
+ *
+ * @return
+ * 0 if the capacity was reduced\n
+ * 1 otherwise
+ */
+int tarrayShrink(TArray array);
+
+/**
+ * Returns the size of a typed array.
+ *
+ * @param array the array
+ *
+ * @return
+ * the size of the array
+ */
+int tarraySize(TArray array);
+
+/**
+ * Provides the elements of a typed array as a contiguous block of memory.
+ *
+ * @attention
+ * The block becomes invalid when the capacity of the array changes.
+ *
+ * @param array the array
+ *
+ * @return
+ * the elements of the array
+ */
+void* tarrayData(TArray array);
+
+/**
+ * Applies a function to the elements of a typed array.
+ *
+ * The function to be applied must be of type <tt>void fun(void*)</tt>, and it
+ * receives a pointer to each element (so it can change the element).
+ *
+ * @param array the array
+ * @param fun   the function to be applied
+ *
+ * @return
+ * 0 if the array was not empty\n
+ * 1 otherwise
+ */
+int tarrayMap(TArray array,void(*fun)(void*));
+
+#endif
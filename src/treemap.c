@@ -180,7 +180,7 @@ static TreeNode rLeftBalance(TreeNode tree,int* h)
                break;
       case E : tree=rightRotate(tree);
                tree->bf=R;
-               tree->bf=L;
+               tree->right->bf=L;
                *h=2;
                break;
       case R : tree->left=leftRotate(tree->left);
@@ -188,7 +188,7 @@ static TreeNode rLeftBalance(TreeNode tree,int* h)
                switch(tree->bf)
                {
                  case L : tree->left->bf=E;
-                          tree->right->bf=E;
+                          tree->right->bf=R;
                           break;
                  case E : tree->left->bf=E;
                           tree->right->bf=E;
@@ -281,6 +281,9 @@ TreeMap newTree(int(*keyComp)(void*,void*))
       tree->keyComp=*keyComp;
       tree->size=0;
       tree->root=NULL;
+      tree->hint=NULL;
+      tree->min=NULL;
+      tree->max=NULL;
     }
   }
   return tree;
@@ -330,6 +333,7 @@ void treeDelete(TreeMap tree)
  * @param key     the key
  * @param val     the value to be inserted
  * @param replace specifies whether an old value shall be replaced
+ * @param fun     function to be applied to the value slot (or <tt>NULL</tt>)
  * @param h       specifies whether the height of the tree changed (h<0?), and
  * whether an error occurred (h>0?)
  * @param comp    key comparison function
@@ -337,8 +341,8 @@ void treeDelete(TreeMap tree)
  * @return
  * new tree
  */
-static TreeNode treeInsAux(TreeNode tree,void* key,void* val,int replace,int* h,
-    int(*comp)(void*,void*))
+static TreeNode treeInsAux(TreeNode tree,void* key,void* val,int replace,
+    void(*fun)(void*,void**),int* h,int(*comp)(void*,void*))
 {
   int sig;
   if(!tree)
@@ -352,6 +356,7 @@ static TreeNode treeInsAux(TreeNode tree,void* key,void* val,int replace,int* h,
       tree->super=NULL;
       tree->left=NULL;
       tree->right=NULL;
+      if(fun) fun(key,&tree->value);
       *h=0;
     }
     else *h=2;
@@ -361,7 +366,7 @@ static TreeNode treeInsAux(TreeNode tree,void* key,void* val,int replace,int* h,
     sig=comp(key,tree->key);
     if(sig<0)
     {
-      tree->left=treeInsAux(tree->left,key,val,replace,h,comp);
+      tree->left=treeInsAux(tree->left,key,val,replace,fun,h,comp);
       if(!(*h))
       {
         tree->left->super=tree;
@@ -381,7 +386,7 @@ static TreeNode treeInsAux(TreeNode tree,void* key,void* val,int replace,int* h,
     }
     else if(sig>0)
     {
-      tree->right=treeInsAux(tree->right,key,val,replace,h,comp);
+      tree->right=treeInsAux(tree->right,key,val,replace,fun,h,comp);
       if(!(*h))
       {
         tree->right->super=tree;
@@ -401,7 +406,8 @@ static TreeNode treeInsAux(TreeNode tree,void* key,void* val,int replace,int* h,
     }
     else
     {
-      if(replace) tree->value=val;
+      if(fun) fun(tree->key,&tree->value);
+      else if(replace) tree->value=val;
       *h=1;
     }
   }
@@ -410,17 +416,216 @@ static TreeNode treeInsAux(TreeNode tree,void* key,void* val,int replace,int* h,
 
 //==============================================================================
 
+/**
+ * Updates the nodes with the least and the greatest keys of a tree.
+ *
+ * @param tree the tree
+ */
+static void treeBounds(TreeMap tree)
+{
+  TreeNode aux;
+  for(aux=tree->root;aux&&aux->left;aux=aux->left);
+  tree->min=aux;
+  for(aux=tree->root;aux&&aux->right;aux=aux->right);
+  tree->max=aux;
+}
+
+//==============================================================================
+
+/**
+ * Updates the nodes with the least and the greatest keys of a tree, after a
+ * key was inserted.
+ *
+ * @param tree the tree
+ * @param key  the inserted key
+ */
+static void treeInsBounds(TreeMap tree,void* key)
+{
+  if(!tree->min||tree->keyComp(key,tree->min->key)<0||
+     tree->keyComp(key,tree->max->key)>0)
+    treeBounds(tree);
+}
+
+//==============================================================================
+
 int treeInsert(TreeMap tree,void* key,void* val,int replace)
 {
   int h,result=0;
-  tree->root=treeInsAux(tree->root,key,val,replace,&h,tree->keyComp);
-  if(h<1) tree->size++;
+  tree->root=treeInsAux(tree->root,key,val,replace,NULL,&h,tree->keyComp);
+  if(h<1)
+  {
+    tree->size++;
+    treeInsBounds(tree,key);
+  }
+  else result=h;
+  return result;
+}
+
+//==============================================================================
+
+int treeUpsert(TreeMap tree,void* key,void(*fun)(void*,void**))
+{
+  int h,result=0;
+  tree->root=treeInsAux(tree->root,key,NULL,0,fun,&h,tree->keyComp);
+  if(h<1)
+  {
+    tree->size++;
+    treeInsBounds(tree,key);
+  }
   else result=h;
   return result;
 }
 
 //==============================================================================
 
+/**
+ * Replaces a child of a node (or the root of a tree, if the node is
+ * <tt>NULL</tt>).
+ *
+ * @param tree  the tree
+ * @param super the parent node (or <tt>NULL</tt>)
+ * @param old   the old child
+ * @param new   the new child
+ */
+static void treeRelink(TreeMap tree,TreeNode super,TreeNode old,TreeNode new)
+{
+  if(!super) tree->root=new;
+  else if(super->left==old) super->left=new;
+  else super->right=new;
+}
+
+//==============================================================================
+
+/**
+ * Updates the balance factors of the ancestors of a new leaf, walking up
+ * through the parent links, and rebalances the tree if needed.
+ *
+ * @param tree the tree
+ * @param node the new leaf
+ */
+static void treeRetrace(TreeMap tree,TreeNode node)
+{
+  int stop;
+  TreeNode parent,super;
+  for(stop=0;!stop&&node->super;node=parent)
+  {
+    parent=node->super;
+    if(node==parent->left)
+    {
+      switch(parent->bf)
+      {
+        case L : super=parent->super;
+                 treeRelink(tree,super,parent,leftBalance(parent));
+                 stop=1;
+                 break;
+        case E : parent->bf=L;
+                 break;
+        case R : parent->bf=E;
+                 stop=1;
+                 break;
+      }
+    }
+    else
+    {
+      switch(parent->bf)
+      {
+        case L : parent->bf=E;
+                 stop=1;
+                 break;
+        case E : parent->bf=R;
+                 break;
+        case R : super=parent->super;
+                 treeRelink(tree,super,parent,rightBalance(parent));
+                 stop=1;
+                 break;
+      }
+    }
+  }
+}
+
+//==============================================================================
+
+/**
+ * Finds the lowest ancestor of a node whose subtree may contain a key.
+ *
+ * Climbs from the node while the key is outside the range of keys of the
+ * current subtree.  Only the ancestors where the path turns are compared to
+ * the key.
+ *
+ * @param node the starting node
+ * @param key  the key
+ * @param comp key comparison function
+ *
+ * @return
+ * the node from which the search for the key shall start
+ */
+static TreeNode treeFinger(TreeNode node,void* key,int(*comp)(void*,void*))
+{
+  int sig,r,stop;
+  TreeNode aux;
+  sig=comp(key,node->key);
+  for(aux=node,stop=!sig;!stop&&aux->super;aux=aux->super)
+  {
+    if(sig>0?aux==aux->super->left:aux==aux->super->right)
+    {
+      r=comp(key,aux->super->key);
+      if(!r||(r>0)==(sig>0)) node=aux->super;
+      stop=!r||(r>0)!=(sig>0);
+    }
+  }
+  return node;
+}
+
+//==============================================================================
+
+int treeInsertHint(TreeMap tree,void* key,void* val,int replace)
+{
+  int sig=0,result=0;
+  TreeNode aux=tree->hint,new;
+  if(!aux) aux=tree->root;
+  else if(!(aux==tree->max&&(*tree->keyComp)(key,aux->key)>0)&&
+          !(aux==tree->min&&(*tree->keyComp)(key,aux->key)<0))
+    aux=treeFinger(aux,key,tree->keyComp);
+  if(aux)
+  {
+    for(sig=(*tree->keyComp)(key,aux->key);
+        (sig<0&&aux->left)||(sig>0&&aux->right);
+        sig=(*tree->keyComp)(key,aux->key))
+      aux=sig<0?aux->left:aux->right;
+  }
+  if(aux&&!sig)
+  {
+    if(replace) aux->value=val;
+    tree->hint=aux;
+    result=1;
+  }
+  else
+  {
+    new=malloc(sizeof(STreeNode));
+    if(new)
+    {
+      new->key=key;
+      new->value=val;
+      new->bf=E;
+      new->super=aux;
+      new->left=NULL;
+      new->right=NULL;
+      if(!aux) tree->root=new;
+      else if(sig<0) aux->left=new;
+      else aux->right=new;
+      if(!aux||(sig>0&&aux==tree->max)) tree->max=new;
+      if(!aux||(sig<0&&aux==tree->min)) tree->min=new;
+      treeRetrace(tree,new);
+      tree->hint=new;
+      tree->size++;
+    }
+    else result=2;
+  }
+  return result;
+}
+
+//==============================================================================
+
 /**
  * Remotion auxiliary function.
  *
@@ -540,6 +745,8 @@ int treeRemove(TreeMap tree,void* key,void** value,void(*del)(void*))
 {
   int h,result=0;
   tree->root=treeRemAux(tree->root,key,value,del,&h,tree->keyComp);
+  tree->hint=NULL;
+  treeBounds(tree);
   if(h==1) result=1;
   else tree->size--;
   return result;
@@ -790,3 +997,155 @@ Iterator treeValues(TreeMap tree)
   }
   return it;
 }
+
+//==============================================================================
+
+/**
+ * Returns the node that follows a node of a tree (inorder traversal).
+ *
+ * @param node the node
+ *
+ * @return
+ * <tt>NULL</tt> if <tt>node</tt> is the last node\n
+ * the next node otherwise
+ */
+static TreeNode treeNextNode(TreeNode node)
+{
+  if(node->right) for(node=node->right;node->left;node=node->left);
+  else
+  {
+    for(;node->super&&node==node->super->right;node=node->super);
+    node=node->super;
+  }
+  return node;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next key or value of a lazy iterator over a tree.
+ *
+ * The state of the iterator holds the next node, the node where the iteration
+ * stops (or <tt>NULL</tt>), and whether keys (<tt>index[1]!=0</tt>) or values
+ * shall be provided.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int treeLazyNext(LazyIt it,void** val)
+{
+  int result=0;
+  TreeNode aux=it->state[0];
+  if(aux==it->state[1]) result=1;
+  else
+  {
+    *val=it->index[1]?aux->key:aux->value;
+    it->state[0]=treeNextNode(aux);
+  }
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Collects, in order, the nodes of a tree above a given depth.
+ *
+ * @param tree  the tree
+ * @param depth the depth
+ * @param nodes array where the nodes will be put
+ * @param n     pointer to the number of nodes collected
+ */
+static void treeSplitAux(TreeNode tree,int depth,TreeNode* nodes,int* n)
+{
+  if(tree&&depth>0)
+  {
+    treeSplitAux(tree->left,depth-1,nodes,n);
+    nodes[(*n)++]=tree;
+    treeSplitAux(tree->right,depth-1,nodes,n);
+  }
+}
+
+//==============================================================================
+
+/**
+ * Splits the keys or the values of a tree into disjoint lazy iterators.
+ *
+ * The nodes above a depth where there are at least <tt>n</tt> subtrees are used
+ * as boundaries between parts.
+ *
+ * @param tree  the tree
+ * @param n     the maximum number of parts
+ * @param parts array where the lazy iterators will be put
+ * @param keys  specifies whether keys (<tt>keys!=0</tt>) or values shall be
+ * provided
+ *
+ * @return
+ * -1 if an error occurred\n
+ * the number of lazy iterators created otherwise
+ */
+static int treeSplit(TreeMap tree,int n,LazyIt* parts,int keys)
+{
+  int i,depth,size=0,result=-1;
+  TreeNode aux,* nodes=NULL;
+  for(depth=0;(1<<depth)<n&&depth<30;depth++);
+  if(n>0) nodes=malloc((1<<depth)*sizeof(TreeNode));
+  if(nodes)
+  {
+    treeSplitAux(tree->root,depth,nodes,&size);
+    result=size<n-1?size+1:n;
+    if(!tree->root) result=0;
+    for(aux=tree->root;aux&&aux->left;aux=aux->left);
+    for(i=0;i<result&&(parts[i]=newLazy(treeLazyNext,NULL));i++)
+    {
+      parts[i]->state[0]=i?nodes[(int)((long)(size+1)*i/result)-1]:aux;
+      parts[i]->state[1]=i<result-1?nodes[(int)((long)(size+1)*(i+1)/result)-1]
+                                    :NULL;
+      parts[i]->index[1]=keys;
+    }
+    if(i<result)
+    {
+      while(i>0) lazyDelete(parts[--i]);
+      result=-1;
+    }
+    free(nodes);
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt treeLazyKeys(TreeMap tree)
+{
+  LazyIt it=NULL;
+  if(!tree->root) it=newLazy(treeLazyNext,NULL);
+  else if(treeSplit(tree,1,&it,1)!=1) it=NULL;
+  return it;
+}
+
+//==============================================================================
+
+LazyIt treeLazyValues(TreeMap tree)
+{
+  LazyIt it=NULL;
+  if(!tree->root) it=newLazy(treeLazyNext,NULL);
+  else if(treeSplit(tree,1,&it,0)!=1) it=NULL;
+  return it;
+}
+
+//==============================================================================
+
+int treeSplitKeys(TreeMap tree,int n,LazyIt* parts)
+{
+  return treeSplit(tree,n,parts,1);
+}
+
+//==============================================================================
+
+int treeSplitValues(TreeMap tree,int n,LazyIt* parts)
+{
+  return treeSplit(tree,n,parts,0);
+}
@@ -31,6 +31,7 @@ int keyComp(void* key1,void* key2)
 #define _TREEMAP_H_
 
 #include "iterator.h"
+#include "lazyit.h"
 
 /**
  * Type that defines the balance factor of a tree.
@@ -72,6 +73,12 @@ typedef struct sTreeMap
   int size;
   ///Root node of this tree.
   TreeNode root;
+  ///Last node inserted with <tt>@ref treeInsertHint</tt> (or <tt>NULL</tt>).
+  TreeNode hint;
+  ///Node with the least key of this tree (or <tt>NULL</tt>).
+  TreeNode min;
+  ///Node with the greatest key of this tree (or <tt>NULL</tt>).
+  TreeNode max;
 }STreeMap;
 
 /**
@@ -135,6 +142,65 @@ void treeDelete(TreeMap tree);
  */
 int treeInsert(TreeMap tree,void* key,void* value,int replace);
 
+/**
+ * Associates a value to a key in a tree, starting the search from the last node
+ * inserted by this function.
+ *
+ * Instead of descending from the root, this function climbs from the last
+ * inserted node (using the parent links) only as far as needed to find the
+ * subtree where the key belongs.  When keys are inserted in (nearly) sorted
+ * order, only a constant number of key comparisons is needed on average, and
+ * a key greater (or less) than all the keys of the tree is appended in
+ * constant time when the last inserted node is the greatest (or the least).
+ *
+ * The behaviour is otherwise the same as <tt>@ref treeInsert</tt>.  Removing an
+ * element from the tree resets the starting point to the root.
+ *
+ * @param tree    the tree
+ * @param key     the key
+ * @param value   the value to be inserted
+ * @param replace specifies whether an old value shall be replaced
+ *
+ * @return
+ * 0 if the value was inserted\n
+ * 1 if the key already had a value\n
+ * 2 if an error occurred
+ */
+int treeInsertHint(TreeMap tree,void* key,void* value,int replace);
+
+/**
+ * Inserts or updates the mapping for a key in a tree, in a single traversal.
+ *
+ * The function <tt>fun</tt>, of type <tt>void fun(void* key,void** value)</tt>,
+ * is applied to the key and to a pointer to the value slot associated to it.
+ * If the key was not in the tree, a new mapping is created with value
+ * <tt>NULL</tt> before <tt>fun</tt> is applied, so that <tt>fun</tt> may
+ * initialize it.  Otherwise, <tt>fun</tt> receives the key stored in the tree
+ * and may modify the existing value in place.
+ * If <tt>fun</tt> is <tt>NULL</tt>, the function behaves as a plain insertion:
+ * a missing key is mapped to <tt>NULL</tt>, and an existing value is left
+ * unchanged.
+ *
+ * E.g. (counting occurrences of a key):
+\code
+void count(void* key,void** value)
+{
+  if(!*value) *value=calloc(1,sizeof(int));
+  if(*value) (*(int*)*value)++;
+}
+\endcode
+ *
+ * @param tree the tree
+ * @param key  the key
+ * @param fun  function to be applied to the value slot (or <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if a new mapping was created\n
+ * 1 if the key already had a value\n
+ * 2 if an error occurred
+ */
+int treeUpsert(TreeMap tree,void* key,void(*fun)(void*,void**));
+
 /**
  * Removes the mapping for a key from a tree.
  *
@@ -283,4 +349,74 @@ Iterator treeKeys(TreeMap tree);
  */
 Iterator treeValues(TreeMap tree);
 
+/**
+ * Creates a lazy iterator from the keys of a tree (in key order).
+ *
+ * @see LazyIt
+ *
+ * @param tree the tree
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt treeLazyKeys(TreeMap tree);
+
+/**
+ * Creates a lazy iterator from the values of a tree (in key order).
+ *
+ * @see LazyIt
+ *
+ * @param tree the tree
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt treeLazyValues(TreeMap tree);
+
+/**
+ * Splits the keys of a tree into disjoint lazy iterators, which can be
+ * consumed concurrently.
+ *
+ * The keys are split into at most <tt>n</tt> ranges, according to the shape
+ * of the tree, so that each part holds a similar number of elements.  The
+ * elements of each part are provided in key order.
+ *
+ * @see LazyIt
+ *
+ * @param tree  the tree
+ * @param n     the maximum number of parts (a positive number)
+ * @param parts array where the lazy iterators will be put (with at least
+ * <tt>n</tt> positions)
+ *
+ * @return
+ * -1 if an error occurred, or <tt>n</tt> was not positive (no lazy iterator is
+ * created)\n
+ * the number of lazy iterators created otherwise
+ */
+int treeSplitKeys(TreeMap tree,int n,LazyIt* parts);
+
+/**
+ * Splits the values of a tree into disjoint lazy iterators, which can be
+ * consumed concurrently.
+ *
+ * The keys are split into at most <tt>n</tt> ranges, according to the shape
+ * of the tree, so that each part holds a similar number of elements.  The
+ * elements of each part are provided in key order.
+ *
+ * @see LazyIt
+ *
+ * @param tree  the tree
+ * @param n     the maximum number of parts (a positive number)
+ * @param parts array where the lazy iterators will be put (with at least
+ * <tt>n</tt> positions)
+ *
+ * @return
+ * -1 if an error occurred, or <tt>n</tt> was not positive (no lazy iterator is
+ * created)\n
+ * the number of lazy iterators created otherwise
+ */
+int treeSplitValues(TreeMap tree,int n,LazyIt* parts);
+
 #endif
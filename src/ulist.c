@@ -0,0 +1,419 @@
+/**
+ * Implementation of an unrolled linked list.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ulist.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "ulist.h"
+
+UList newUList(void)
+{
+  UList list=malloc(sizeof(SUList));
+  if(list)
+  {
+    list->size=0;
+    list->first=NULL;
+    list->last=NULL;
+  }
+  return list;
+}
+
+//==============================================================================
+
+void ulistDelete(UList list)
+{
+  UListNode this,next;
+  for(this=list->first;this;this=next)
+  {
+    next=this->next;
+    free(this);
+  }
+  free(list);
+}
+
+//==============================================================================
+
+/**
+ * Creates an empty node, and inserts it after a node of an unrolled list.
+ *
+ * @param list the list
+ * @param prev the node after which the new node is inserted (or <tt>NULL</tt>
+ * to insert it at the beginning of the list)
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new node otherwise
+ */
+static UListNode ulistNewNode(UList list,UListNode prev)
+{
+  UListNode new=malloc(sizeof(SUListNode));
+  if(new)
+  {
+    new->size=0;
+    new->prev=prev;
+    new->next=prev?prev->next:list->first;
+    if(new->prev) new->prev->next=new;
+    else list->first=new;
+    if(new->next) new->next->prev=new;
+    else list->last=new;
+  }
+  return new;
+}
+
+//==============================================================================
+
+/**
+ * Removes a node from an unrolled list, and frees it.
+ *
+ * @param list the list
+ * @param node the node
+ */
+static void ulistFreeNode(UList list,UListNode node)
+{
+  if(node->prev) node->prev->next=node->next;
+  else list->first=node->next;
+  if(node->next) node->next->prev=node->prev;
+  else list->last=node->prev;
+  free(node);
+}
+
+//==============================================================================
+
+/**
+ * Finds the node that holds the element at the specified position of an
+ * unrolled list.
+ *
+ * The nodes are traversed from the end of the list closer to the position.
+ *
+ * @param list  the list
+ * @param index pointer to the position (a valid index), where the position
+ * inside the node will be put
+ *
+ * @return
+ * the node that holds the element
+ */
+static UListNode ulistFind(UList list,int* index)
+{
+  int pos=*index;
+  UListNode aux;
+  if(pos>list->size/2)
+  {
+    for(pos=list->size-pos,aux=list->last;pos>aux->size;aux=aux->prev)
+      pos-=aux->size;
+    pos=aux->size-pos;
+  }
+  else for(aux=list->first;pos>=aux->size;aux=aux->next) pos-=aux->size;
+  *index=pos;
+  return aux;
+}
+
+//==============================================================================
+
+/**
+ * Inserts an element at the specified position of a node of an unrolled list.
+ *
+ * If the node is full, it is split in two halves.
+ *
+ * @param list  the list
+ * @param node  the node
+ * @param pos   the position inside the node
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if it was not possible to insert the new element
+ */
+static int ulistInsertIn(UList list,UListNode node,int pos,void* value)
+{
+  int result=0;
+  UListNode new;
+  if(node->size==ULIST_CHUNK)
+  {
+    new=ulistNewNode(list,node);
+    if(!new) result=1;
+    else
+    {
+      memcpy(new->values,node->values+ULIST_CHUNK/2,
+             (ULIST_CHUNK-ULIST_CHUNK/2)*sizeof(void*));
+      new->size=ULIST_CHUNK-ULIST_CHUNK/2;
+      node->size=ULIST_CHUNK/2;
+      if(pos>node->size)
+      {
+        pos-=node->size;
+        node=new;
+      }
+    }
+  }
+  if(!result)
+  {
+    memmove(node->values+pos+1,node->values+pos,
+            (node->size-pos)*sizeof(void*));
+    node->values[pos]=value;
+    node->size++;
+    list->size++;
+  }
+  return result;
+}
+
+//==============================================================================
+
+/**
+ * Removes the element at the specified position of a node of an unrolled list.
+ *
+ * Empty nodes are freed, and a node is merged with the next one (or else with
+ * the previous one) when both fit in half a node.
+ *
+ * @param list  the list
+ * @param node  the node
+ * @param pos   the position inside the node
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ */
+static void ulistRemoveIn(UList list,UListNode node,int pos,void** value)
+{
+  UListNode prev=node->prev,next=node->next;
+  if(value) *value=node->values[pos];
+  node->size--;
+  list->size--;
+  memmove(node->values+pos,node->values+pos+1,
+          (node->size-pos)*sizeof(void*));
+  if(!node->size) ulistFreeNode(list,node);
+  else if(next&&node->size+next->size<=ULIST_CHUNK/2)
+  {
+    memcpy(node->values+node->size,next->values,next->size*sizeof(void*));
+    node->size+=next->size;
+    ulistFreeNode(list,next);
+  }
+  else if(prev&&prev->size+node->size<=ULIST_CHUNK/2)
+  {
+    memcpy(prev->values+prev->size,node->values,node->size*sizeof(void*));
+    prev->size+=node->size;
+    ulistFreeNode(list,node);
+  }
+}
+
+//==============================================================================
+
+int ulistInsertFst(UList list,void* value)
+{
+  int result=0;
+  UListNode node=list->first;
+  if(!node||node->size==ULIST_CHUNK) node=ulistNewNode(list,NULL);
+  if(!node) result=1;
+  else ulistInsertIn(list,node,0,value);
+  return result;
+}
+
+//==============================================================================
+
+int ulistInsertLst(UList list,void* value)
+{
+  int result=0;
+  UListNode node=list->last;
+  if(!node||node->size==ULIST_CHUNK) node=ulistNewNode(list,list->last);
+  if(!node) result=1;
+  else ulistInsertIn(list,node,node->size,value);
+  return result;
+}
+
+//==============================================================================
+
+int ulistInsertAt(UList list,int index,void* value)
+{
+  int result=0;
+  UListNode aux;
+  if(index<0||index>list->size) result=1;
+  else if(!index) result=2*ulistInsertFst(list,value);
+  else if(index==list->size) result=2*ulistInsertLst(list,value);
+  else
+  {
+    aux=ulistFind(list,&index);
+    if(!index&&aux->prev->size<ULIST_CHUNK)
+    {
+      aux=aux->prev;
+      index=aux->size;
+    }
+    result=2*ulistInsertIn(list,aux,index,value);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int ulistRemoveFst(UList list,void** value)
+{
+  int result=0;
+  if(!list->size)
+  {
+    if(value) *value=NULL;
+    result=1;
+  }
+  else ulistRemoveIn(list,list->first,0,value);
+  return result;
+}
+
+//==============================================================================
+
+int ulistRemoveLst(UList list,void** value)
+{
+  int result=0;
+  if(!list->size)
+  {
+    if(value) *value=NULL;
+    result=1;
+  }
+  else ulistRemoveIn(list,list->last,list->last->size-1,value);
+  return result;
+}
+
+//==============================================================================
+
+int ulistRemoveAt(UList list,int index,void** value)
+{
+  int result=0;
+  UListNode aux;
+  if(index<0||index>list->size-1) result=1;
+  else
+  {
+    aux=ulistFind(list,&index);
+    ulistRemoveIn(list,aux,index,value);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int ulistFst(UList list,void** value)
+{
+  int result=0;
+  if(!list->size)
+  {
+    *value=NULL;
+    result=1;
+  }
+  else *value=list->first->values[0];
+  return result;
+}
+
+//==============================================================================
+
+int ulistLst(UList list,void** value)
+{
+  int result=0;
+  if(!list->size)
+  {
+    *value=NULL;
+    result=1;
+  }
+  else *value=list->last->values[list->last->size-1];
+  return result;
+}
+
+//==============================================================================
+
+int ulistAt(UList list,int index,void** value)
+{
+  int result=0;
+  UListNode aux;
+  if(index<0||index>list->size-1)
+  {
+    *value=NULL;
+    result=1;
+  }
+  else
+  {
+    aux=ulistFind(list,&index);
+    *value=aux->values[index];
+  }
+  return result;
+}
+
+//==============================================================================
+
+int ulistSize(UList list)
+{
+  return list->size;
+}
+
+//==============================================================================
+
+int ulistMap(UList list,void(*fun)(void*))
+{
+  int i,result=0;
+  UListNode aux;
+  if(!list->size) result=1;
+  else
+  {
+    for(aux=list->first;aux;aux=aux->next)
+      for(i=0;i<aux->size;i++)
+        fun(aux->values[i]);
+  }
+  return result;
+}
+
+//==============================================================================
+
+Iterator ulistIterator(UList list)
+{
+  int i,ctrl=0;
+  UListNode aux;
+  Iterator it;
+  it=newIt(list->size);
+  if(it)
+  {
+    for(aux=list->first;aux&&!ctrl;aux=aux->next)
+      for(i=0;i<aux->size&&!ctrl;i++)
+        ctrl=itAdd(it,aux->values[i]);
+    if(ctrl)
+    {
+      itDelete(it);
+      it=NULL;
+    }
+  }
+  return it;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator over an unrolled list.
+ *
+ * The state of the iterator holds the current node, and the next position
+ * inside that node.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int ulistLazyNext(LazyIt it,void** val)
+{
+  int result=0;
+  UListNode aux=it->state[0];
+  if(!aux) result=1;
+  else
+  {
+    *val=aux->values[it->index[0]++];
+    if(it->index[0]==aux->size)
+    {
+      it->state[0]=aux->next;
+      it->index[0]=0;
+    }
+  }
+  return result;
+}
+
+//==============================================================================
+
+LazyIt ulistLazy(UList list)
+{
+  LazyIt it=newLazy(ulistLazyNext,NULL);
+  if(it) it->state[0]=list->first;
+  return it;
+}
@@ -0,0 +1,283 @@
+/**
+ * Implementation of an unrolled linked list.
+ *
+ * Provides functions to create and manipulate an unrolled linked list, i.e. a
+ * linked list whose nodes hold up to <tt>@ref ULIST_CHUNK</tt> values each.
+ * Consecutive values are stored contiguously, so traversals touch far fewer
+ * nodes than with a <tt>@ref List</tt>, and the memory used by links and by
+ * allocations is shared by many values.
+ *
+ * The API is the same as the one of <tt>@ref List</tt>.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file ulist.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _ULIST_H_
+#define _ULIST_H_
+
+#include "iterator.h"
+#include "lazyit.h"
+
+/**
+ * Maximum number of values of each node of an unrolled list.
+ */
+#define ULIST_CHUNK 32
+
+/**
+ * Unrolled list node structure.
+ */
+typedef struct sUListNode
+{
+  ///Number of values of this node.
+  int size;
+  ///Previous node.
+  struct sUListNode* prev;
+  ///Next node.
+  struct sUListNode* next;
+  ///Node's values (at positions 0 to <tt>size-1</tt>).
+  void* values[ULIST_CHUNK];
+}SUListNode;
+
+/**
+ * Unrolled list node definition.
+ */
+typedef SUListNode* UListNode;
+
+/**
+ * Unrolled list structure.
+ */
+typedef struct sUList
+{
+  ///Number of elements of this list.
+  int size;
+  ///First node.
+  UListNode first;
+  ///Last node.
+  UListNode last;
+}SUList;
+
+/**
+ * Unrolled list definition.
+ */
+typedef SUList* UList;
+
+//==============================================================================
+
+/**
+ * Creates an unrolled list.
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new list otherwise
+ */
+UList newUList(void);
+
+/**
+ * Deletes an unrolled list.
+ *
+ * @attention
+ * This function only frees the memory used by the list.  It does not free the
+ * memory used by elements the list contains.
+ *
+ * @param list the list to be deleted
+ */
+void ulistDelete(UList list);
+
+/**
+ * Inserts an element at the beginning of an unrolled list.
+ *
+ * @param list  the list
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if it was not possible to insert the new element
+ */
+int ulistInsertFst(UList list,void* value);
+
+/**
+ * Inserts an element at the end of an unrolled list.
+ *
+ * @param list  the list
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if it was not possible to insert the new element
+ */
+int ulistInsertLst(UList list,void* value);
+
+/**
+ * Inserts an new element at the specified position of an unrolled list.
+ *
+ * The position, specified by argument <tt>index</tt>, must be a non negative
+ * integer, and not greater than the current size of the list.
+ *
+ * @param list  the list
+ * @param index the index at which the new value is to be inserted
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if the position was not valid\n
+ * 2 if it was not possible to insert the new element
+ */
+int ulistInsertAt(UList list,int index,void* value);
+
+/**
+ * Removes the first element of an unrolled list.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param list  the list.
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the list was empty
+ */
+int ulistRemoveFst(UList list,void** value);
+
+/**
+ * Removes the last element of an unrolled list.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param list  the list.
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the list was empty
+ */
+int ulistRemoveLst(UList list,void** value);
+
+/**
+ * Removes the element at the specified position of an unrolled list.
+ *
+ * Provides the value of the removed element if the value of <tt>value</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param list  the list.
+ * @param index the index of the element to be removed
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the value of <tt>index</tt> was invalid
+ */
+int ulistRemoveAt(UList list,int index,void** value);
+
+/**
+ * Provides the value at the first position of an unrolled list.
+ *
+ * If the list is empty, it will be put the value <tt>NULL</tt> at
+ * <tt>value</tt>.
+ *
+ * @param list  the list
+ * @param value pointer where the value at the first position will be put
+ *
+ * @return
+ * 0 if the list was not empty\n
+ * 1 otherwise
+ */
+int ulistFst(UList list,void** value);
+
+/**
+ * Provides the value at the last position of an unrolled list.
+ *
+ * If the list is empty, it will be put the value <tt>NULL</tt> at
+ * <tt>value</tt>.
+ *
+ * @param list  the list
+ * @param value pointer where the value at the last position will be put
+ *
+ * @return
+ * 0 if the list was not empty\n
+ * 1 otherwise
+ */
+int ulistLst(UList list,void** value);
+
+/**
+ * Provides the element at the specified position of an unrolled list.
+ *
+ * If there is no element at the specified position, it will be put the value
+ * <tt>NULL</tt> at <tt>value</tt>.
+ *
+ * @param list  the list
+ * @param index the index of the element to be provided
+ * @param value pointer where the value at the specified position will be put
+ *
+ * @return
+ * 0 if there was an elements at the specified position\n
+ * 1 otherwise
+ */
+int ulistAt(UList list,int index,void** value);
+
+/**
+ * Returns the size of an unrolled list.
+ *
+ * @param list the list
+ *
+ * @return
+ * the size of the list
+ */
+int ulistSize(UList list);
+
+/**
+ * Applies a function to the elements of an unrolled list.
+ *
+ * The function to be applied must be of type <tt>void fun(void*)</tt>.
+ *
+ * @param list the list
+ * @param fun  the function to be applied
+ *
+ * @return
+ * 0 if the list was not empty\n
+ * 1 otherwise
+ */
+int ulistMap(UList list,void(*fun)(void*));
+
+/**
+ * Creates an iterator from an unrolled list.
+ *
+ * @see Iterator
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator ulistIterator(UList list);
+
+/**
+ * Creates a lazy iterator from an unrolled list.
+ *
+ * @see LazyIt
+ *
+ * @param list the list
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt ulistLazy(UList list);
+
+#endif
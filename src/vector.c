@@ -0,0 +1,235 @@
+/**
+ * Implementation of a vector (dense dynamic array).
+ *
+ * @author Rui Carlos Gonçalves
+ * @file vector.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include "vector.h"
+
+Vector newVector(int capacity)
+{
+  Vector vector=NULL;
+  if(capacity>0)
+  {
+    vector=malloc(sizeof(SVector));
+    if(vector)
+    {
+      vector->capacity=capacity;
+      vector->size=0;
+      vector->array=malloc(capacity*sizeof(void*));
+      if(!vector->array)
+      {
+        free(vector);
+        vector=NULL;
+      }
+    }
+  }
+  return vector;
+}
+
+//==============================================================================
+
+void vectorDelete(Vector vector)
+{
+  free(vector->array);
+  free(vector);
+}
+
+//==============================================================================
+
+/**
+ * Changes the capacity of a vector.
+ *
+ * @param vector   the vector
+ * @param capacity the new capacity (not less than the size of the vector)
+ *
+ * @return
+ * 0 if the capacity was changed\n
+ * 1 otherwise
+ */
+static int vectorRealloc(Vector vector,int capacity)
+{
+  int result=0;
+  void** newarray=realloc(vector->array,capacity*sizeof(void*));
+  if(!newarray) result=1;
+  else
+  {
+    vector->array=newarray;
+    vector->capacity=capacity;
+  }
+  return result;
+}
+
+//==============================================================================
+
+int vectorPush(Vector vector,void* elem)
+{
+  int result=0;
+  if(vector->size==vector->capacity)
+  {
+    if(vector->capacity==INT_MAX) result=1;
+    else if(vector->capacity>INT_MAX/2) result=vectorRealloc(vector,INT_MAX);
+    else result=vectorRealloc(vector,2*vector->capacity);
+  }
+  if(!result) vector->array[vector->size++]=elem;
+  return result;
+}
+
+//==============================================================================
+
+int vectorPop(Vector vector,void** elem)
+{
+  int result=0;
+  if(!vector->size)
+  {
+    if(elem) *elem=NULL;
+    result=1;
+  }
+  else
+  {
+    vector->size--;
+    if(elem) *elem=vector->array[vector->size];
+  }
+  return result;
+}
+
+//==============================================================================
+
+int vectorBack(Vector vector,void** elem)
+{
+  int result=0;
+  if(!vector->size)
+  {
+    *elem=NULL;
+    result=1;
+  }
+  else *elem=vector->array[vector->size-1];
+  return result;
+}
+
+//==============================================================================
+
+int vectorAt(Vector vector,int index,void** elem)
+{
+  int result=0;
+  if(index<0||index>=vector->size)
+  {
+    *elem=NULL;
+    result=1;
+  }
+  else *elem=vector->array[index];
+  return result;
+}
+
+//==============================================================================
+
+int vectorSet(Vector vector,int index,void* elem)
+{
+  int result=0;
+  if(index<0||index>=vector->size) result=1;
+  else vector->array[index]=elem;
+  return result;
+}
+
+//==============================================================================
+
+int vectorReserve(Vector vector,int capacity)
+{
+  int result=0;
+  if(capacity>vector->capacity) result=vectorRealloc(vector,capacity);
+  return result;
+}
+
+//==============================================================================
+
+int vectorShrink(Vector vector)
+{
+  int result=1;
+  int capacity=vector->size?vector->size:1;
+  if(capacity<vector->capacity) result=vectorRealloc(vector,capacity);
+  return result;
+}
+
+//==============================================================================
+
+int vectorSize(Vector vector)
+{
+  return vector->size;
+}
+
+//==============================================================================
+
+int vectorCapacity(Vector vector)
+{
+  return vector->capacity;
+}
+
+//==============================================================================
+
+void** vectorData(Vector vector)
+{
+  return vector->array;
+}
+
+//==============================================================================
+
+int vectorMap(Vector vector,void(*fun)(void*))
+{
+  int i,result=0;
+  if(!vector->size) result=1;
+  else
+  {
+    for(i=0;i<vector->size;i++)
+      fun(vector->array[i]);
+  }
+  return result;
+}
+
+//==============================================================================
+
+Iterator vectorIterator(Vector vector)
+{
+  Iterator it;
+  it=newIt(vector->size?vector->size:1);
+  if(it)
+  {
+    memcpy(it->values,vector->array,vector->size*sizeof(void*));
+    it->size=vector->size;
+  }
+  return it;
+}
+
+//==============================================================================
+
+/**
+ * Provides the next element of a lazy iterator over a vector.
+ *
+ * @param it  the lazy iterator
+ * @param val pointer were the next element should be put
+ *
+ * @return
+ * 0 if the next element was provided\n
+ * 1 otherwise
+ */
+static int vectorLazyNext(LazyIt it,void** val)
+{
+  int result=0;
+  Vector vector=it->state[0];
+  if(it->index[0]>=vector->size) result=1;
+  else *val=vector->array[it->index[0]++];
+  return result;
+}
+
+//==============================================================================
+
+LazyIt vectorLazy(Vector vector)
+{
+  LazyIt it=newLazy(vectorLazyNext,NULL);
+  if(it) it->state[0]=vector;
+  return it;
+}
@@ -0,0 +1,244 @@
+/**
+ * Implementation of a vector (dense dynamic array).
+ *
+ * Provides functions to create and manipulate a vector, i.e. a sequence of
+ * elements stored contiguously at positions 0 to <tt>size-1</tt>.  Unlike
+ * <tt>@ref Array</tt>, a vector can hold <tt>NULL</tt> elements, and its
+ * capacity grows geometrically, so that appending an element takes amortized
+ * constant time.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file vector.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+
+#include "iterator.h"
+#include "lazyit.h"
+
+/**
+ * Vector structure.
+ */
+typedef struct sVector
+{
+  ///Current capacity of this vector.
+  int capacity;
+  ///Number of elements of this vector.
+  int size;
+  ///Array of pointers to this vector's elements.
+  void** array;
+}SVector;
+
+/**
+ * Vector definition.
+ */
+typedef SVector* Vector;
+
+//==============================================================================
+
+/**
+ * Creates an empty vector, with the specified initial capacity.
+ *
+ * The initial capacity must be a positive number.
+ *
+ * @param capacity the initial capacity of the vector
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new vector otherwise
+ */
+Vector newVector(int capacity);
+
+/**
+ * Deletes a vector.
+ *
+ * @attention
+ * This function only frees the memory used by the vector.  It does not free
+ * the memory used by elements the vector contains.
+ *
+ * @param vector the vector to be deleted
+ */
+void vectorDelete(Vector vector);
+
+/**
+ * Inserts an element at the end of a vector.
+ *
+ * If necessary, the capacity of the vector is doubled.
+ *
+ * @param vector the vector
+ * @param elem   the element to be inserted
+ *
+ * @return
+ * 0 if the new element was inserted\n
+ * 1 if it was not possible to increase the vector capacity
+ */
+int vectorPush(Vector vector,void* elem);
+
+/**
+ * Removes the last element of a vector.
+ *
+ * Provides the value of the removed element if the value of <tt>elem</tt> is
+ * not <tt>NULL</tt>.
+ *
+ * @attention
+ * This function does not free the memory used by the removed element.
+ *
+ * @param vector the vector
+ * @param elem   pointer where the removed element should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if the element was removed\n
+ * 1 if the vector was empty
+ */
+int vectorPop(Vector vector,void** elem);
+
+/**
+ * Provides the last element of a vector.
+ *
+ * If the vector is empty, it will be put the value <tt>NULL</tt> at
+ * <tt>elem</tt>.
+ *
+ * @param vector the vector
+ * @param elem   pointer where the last element will be put
+ *
+ * @return
+ * 0 if the vector was not empty\n
+ * 1 otherwise
+ */
+int vectorBack(Vector vector,void** elem);
+
+/**
+ * Provides the element at the specified position of a vector.
+ *
+ * If there is no element at the specified position, it will be put the value
+ * <tt>NULL</tt> at <tt>elem</tt>.
+ *
+ * @param vector the vector
+ * @param index  the index of the element to be provided
+ * @param elem   pointer where the element at the specified position will be
+ * put
+ *
+ * @return
+ * 0 if there was an element at the specified position\n
+ * 1 otherwise
+ */
+int vectorAt(Vector vector,int index,void** elem);
+
+/**
+ * Replaces the element at the specified position of a vector.
+ *
+ * The position must be a non negative integer, and less than the size of the
+ * vector.
+ *
+ * @param vector the vector
+ * @param index  the index of the element to be replaced
+ * @param elem   the new element
+ *
+ * @return
+ * 0 if the element was replaced\n
+ * 1 if the position was not valid
+ */
+int vectorSet(Vector vector,int index,void* elem);
+
+/**
+ * Ensures that a vector can hold the specified number of elements without
+ * growing.
+ *
+ * @param vector   the vector
+ * @param capacity the required capacity
+ *
+ * @return
+ * 0 if the vector can hold <tt>capacity</tt> elements\n
+ * 1 if it was not possible to increase the vector capacity
+ */
+int vectorReserve(Vector vector,int capacity);
+
+/**
+ * Reduces the capacity of a vector to its size (or to 1, if it is empty).
+ *
+ * @param vector the vector
+ *
+ * @return
+ * 0 if the capacity was reduced\n
+ * 1 otherwise
+ */
+int vectorShrink(Vector vector);
+
+/**
+ * Returns the size of a vector.
+ *
+ * @param vector the vector
+ *
+ * @return
+ * the size of the vector
+ */
+int vectorSize(Vector vector);
+
+/**
+ * Returns the capacity of a vector.
+ *
+ * @param vector the vector
+ *
+ * @return
+ * the capacity of the vector
+ */
+int vectorCapacity(Vector vector);
+
+/**
+ * Provides the elements of a vector as a contiguous array.
+ *
+ * @attention
+ * The array holds <tt>@ref vectorSize</tt> elements, and it becomes invalid
+ * when the capacity of the vector changes.
+ *
+ * @param vector the vector
+ *
+ * @return
+ * the array of elements of the vector
+ */
+void** vectorData(Vector vector);
+
+/**
+ * Applies a function to the elements of a vector.
+ *
+ * The function to be applied must be of type <tt>void fun(void*)</tt>.
+ *
+ * @param vector the vector
+ * @param fun    the function to be applied
+ *
+ * @return
+ * 0 if the vector was not empty\n
+ * 1 otherwise
+ */
+int vectorMap(Vector vector,void(*fun)(void*));
+
+/**
+ * Creates an iterator from a vector.
+ *
+ * @see Iterator
+ *
+ * @param vector the vector
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the iterator otherwise
+ */
+Iterator vectorIterator(Vector vector);
+
+/**
+ * Creates a lazy iterator from a vector.
+ *
+ * @see LazyIt
+ *
+ * @param vector the vector
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the lazy iterator otherwise
+ */
+LazyIt vectorLazy(Vector vector);
+
+#endif
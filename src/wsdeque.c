@@ -0,0 +1,207 @@
+/**
+ * Implementation of a lock-free work-stealing deque.
+ *
+ * @author Rui Carlos Gonçalves
+ * @file wsdeque.c
+ * @version 3.2
+ * @date 10/2026
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include "wsdeque.h"
+
+/**
+ * Given a buffer (<tt>B</tt>) and a position (<tt>I</tt>), provides the
+ * corresponding cell of the buffer.
+ */
+#define CELL(B,I) (&(B)->values[(size_t)(I)&(B)->mask])
+
+/**
+ * Creates a work-stealing deque buffer.
+ *
+ * @param size the capacity of the buffer (a power of two)
+ * @param prev the buffer replaced by the new buffer (or <tt>NULL</tt>)
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new buffer otherwise
+ */
+static WSBuffer newWSBuffer(size_t size,WSBuffer prev)
+{
+  WSBuffer buffer=malloc(sizeof(SWSBuffer)+size*sizeof(_Atomic(void*)));
+  if(buffer)
+  {
+    buffer->mask=size-1;
+    buffer->prev=prev;
+  }
+  return buffer;
+}
+
+//==============================================================================
+
+WSDeque newWSDeque(int capacity)
+{
+  size_t size=1;
+  WSBuffer buffer;
+  WSDeque deque=NULL;
+  if(capacity>0&&capacity<=1<<30)
+  {
+    for(;size<(size_t)capacity;size<<=1);
+    deque=aligned_alloc(WSDEQUE_LINE,sizeof(SWSDeque));
+    if(deque)
+    {
+      buffer=newWSBuffer(size,NULL);
+      if(!buffer)
+      {
+        free(deque);
+        deque=NULL;
+      }
+      else
+      {
+        atomic_init(&deque->top,0);
+        atomic_init(&deque->bottom,0);
+        atomic_init(&deque->buffer,buffer);
+      }
+    }
+  }
+  return deque;
+}
+
+//==============================================================================
+
+void wsdequeDelete(WSDeque deque)
+{
+  WSBuffer aux1,aux2;
+  for(aux1=atomic_load_explicit(&deque->buffer,memory_order_relaxed);aux1;)
+  {
+    aux2=aux1;
+    aux1=aux1->prev;
+    free(aux2);
+  }
+  free(deque);
+}
+
+//==============================================================================
+
+/**
+ * Replaces the buffer of a work-stealing deque by a buffer twice as large.
+ *
+ * May only be called by the owner of the deque.
+ *
+ * @param deque  the deque
+ * @param buffer the current buffer
+ * @param top    the position of the element at the top
+ * @param bottom the position after the element at the bottom
+ *
+ * @return
+ * <tt>NULL</tt> if it was not possible to allocate memory\n
+ * the new buffer otherwise
+ */
+static WSBuffer wsdequeGrow(WSDeque deque,WSBuffer buffer,long top,long bottom)
+{
+  long i;
+  WSBuffer new=NULL;
+  if(buffer->mask<(size_t)INT_MAX) new=newWSBuffer((buffer->mask+1)*2,buffer);
+  if(new)
+  {
+    for(i=top;i<bottom;i++)
+    {
+      atomic_store_explicit(CELL(new,i),
+                            atomic_load_explicit(CELL(buffer,i),
+                                                 memory_order_relaxed),
+                            memory_order_relaxed);
+    }
+    atomic_store_explicit(&deque->buffer,new,memory_order_release);
+  }
+  return new;
+}
+
+//==============================================================================
+
+int wsdequePush(WSDeque deque,void* value)
+{
+  int result=0;
+  long bottom=atomic_load_explicit(&deque->bottom,memory_order_relaxed);
+  long top=atomic_load_explicit(&deque->top,memory_order_acquire);
+  WSBuffer buffer=atomic_load_explicit(&deque->buffer,memory_order_relaxed);
+  if((size_t)(bottom-top)>buffer->mask)
+    buffer=wsdequeGrow(deque,buffer,top,bottom);
+  if(!buffer) result=1;
+  else
+  {
+    atomic_store_explicit(CELL(buffer,bottom),value,memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom,bottom+1,memory_order_release);
+  }
+  return result;
+}
+
+//==============================================================================
+
+int wsdequePop(WSDeque deque,void** value)
+{
+  int result=0;
+  void* aux=NULL;
+  long top,bottom=atomic_load_explicit(&deque->bottom,memory_order_relaxed)-1;
+  WSBuffer buffer=atomic_load_explicit(&deque->buffer,memory_order_relaxed);
+  atomic_store_explicit(&deque->bottom,bottom,memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  top=atomic_load_explicit(&deque->top,memory_order_relaxed);
+  if(top>bottom)
+  {
+    result=1;
+    atomic_store_explicit(&deque->bottom,bottom+1,memory_order_relaxed);
+  }
+  else
+  {
+    aux=atomic_load_explicit(CELL(buffer,bottom),memory_order_relaxed);
+    if(top==bottom)
+    {
+      if(!atomic_compare_exchange_strong_explicit(&deque->top,&top,top+1,
+                                                  memory_order_seq_cst,
+                                                  memory_order_relaxed))
+      {
+        aux=NULL;
+        result=1;
+      }
+      atomic_store_explicit(&deque->bottom,bottom+1,memory_order_relaxed);
+    }
+  }
+  if(value) *value=aux;
+  return result;
+}
+
+//==============================================================================
+
+int wsdequeSteal(WSDeque deque,void** value)
+{
+  int result=0;
+  void* aux=NULL;
+  long bottom,top=atomic_load_explicit(&deque->top,memory_order_acquire);
+  WSBuffer buffer;
+  atomic_thread_fence(memory_order_seq_cst);
+  bottom=atomic_load_explicit(&deque->bottom,memory_order_acquire);
+  if(top>=bottom) result=1;
+  else
+  {
+    buffer=atomic_load_explicit(&deque->buffer,memory_order_acquire);
+    aux=atomic_load_explicit(CELL(buffer,top),memory_order_relaxed);
+    if(!atomic_compare_exchange_strong_explicit(&deque->top,&top,top+1,
+                                                memory_order_seq_cst,
+                                                memory_order_relaxed))
+    {
+      aux=NULL;
+      result=2;
+    }
+  }
+  if(value) *value=aux;
+  return result;
+}
+
+//==============================================================================
+
+int wsdequeSize(WSDeque deque)
+{
+  long top=atomic_load_explicit(&deque->top,memory_order_acquire);
+  long size=atomic_load_explicit(&deque->bottom,memory_order_acquire)-top;
+  return size<0?0:size>INT_MAX?INT_MAX:(int)size;
+}
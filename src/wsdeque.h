@@ -0,0 +1,161 @@
+/**
+ * Implementation of a lock-free work-stealing deque.
+ *
+ * Provides functions to create and manipulate a deque with one owner thread,
+ * which inserts and removes elements at the bottom (in LIFO order), and any
+ * number of thief threads, which steal elements from the top (in FIFO order).
+ * It is the building block of work-stealing schedulers, where each worker owns
+ * a deque of tasks, and idle workers steal tasks from the others.
+ *
+ * The deque is the one proposed by David Chase and Yossi Lev, with the memory
+ * orderings given by Nhat Minh Lê et al. for C11.  The elements are stored in a
+ * circular buffer whose capacity is a power of two, and which is replaced by a
+ * buffer twice as large when it is full.  Since thieves may still be reading a
+ * replaced buffer, replaced buffers are only freed when the deque is deleted
+ * (they take less memory than the current buffer altogether).  The owner only
+ * contends with thieves when the deque has one element.
+ *
+ * Requires C11 atomics (<tt>stdatomic.h</tt>).
+ *
+ * @author Rui Carlos Gonçalves
+ * @file wsdeque.h
+ * @version 3.2
+ * @date 10/2026
+ */
+#ifndef _WSDEQUE_H_
+#define _WSDEQUE_H_
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/**
+ * Size of a cache line (in bytes).
+ */
+#define WSDEQUE_LINE 64
+
+/**
+ * Work-stealing deque buffer structure.
+ */
+typedef struct sWSBuffer
+{
+  ///Capacity of this buffer minus 1 (the capacity is a power of two).
+  size_t mask;
+  ///Buffer replaced by this buffer (or <tt>NULL</tt>).
+  struct sWSBuffer* prev;
+  ///Buffer's values.
+  _Atomic(void*) values[];
+}SWSBuffer;
+
+/**
+ * Work-stealing deque buffer definition.
+ */
+typedef SWSBuffer* WSBuffer;
+
+/**
+ * Work-stealing deque structure.
+ */
+typedef struct sWSDeque
+{
+  ///Position of the element at the top of this deque (updated by thieves).
+  _Alignas(WSDEQUE_LINE) atomic_long top;
+  ///Position after the element at the bottom of this deque (updated by the
+  ///owner).
+  _Alignas(WSDEQUE_LINE) atomic_long bottom;
+  ///Current buffer of this deque.
+  _Atomic(WSBuffer) buffer;
+}SWSDeque;
+
+/**
+ * Work-stealing deque definition.
+ */
+typedef SWSDeque* WSDeque;
+
+//==============================================================================
+
+/**
+ * Creates a work-stealing deque.
+ *
+ * The capacity must be a positive number, and it is rounded up to a power of
+ * two.  The deque grows as needed.
+ *
+ * @param capacity the initial capacity of the deque
+ *
+ * @return
+ * <tt>NULL</tt> if an error occurred\n
+ * the new deque otherwise
+ */
+WSDeque newWSDeque(int capacity);
+
+/**
+ * Deletes a work-stealing deque.
+ *
+ * @attention
+ * This function only frees the memory used by the deque.  It does not free the
+ * memory used by elements the deque contains.  No thread may be using the
+ * deque.
+ *
+ * @param deque the deque to be deleted
+ */
+void wsdequeDelete(WSDeque deque);
+
+/**
+ * Inserts an element at the bottom of a work-stealing deque.
+ *
+ * May only be called by the owner of the deque.
+ *
+ * @param deque the deque
+ * @param value the value to be inserted
+ *
+ * @return
+ * 0 if the new value was inserted\n
+ * 1 if it was not possible to insert the new element
+ */
+int wsdequePush(WSDeque deque,void* value);
+
+/**
+ * Removes the element at the bottom of a work-stealing deque.
+ *
+ * May only be called by the owner of the deque.  Provides the value of the
+ * removed element if the value of <tt>value</tt> is not <tt>NULL</tt>.
+ *
+ * @param deque the deque
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 if the deque was empty
+ */
+int wsdequePop(WSDeque deque,void** value);
+
+/**
+ * Removes the element at the top of a work-stealing deque.
+ *
+ * May be called by any thread.  Provides the value of the removed element if
+ * the value of <tt>value</tt> is not <tt>NULL</tt>.
+ *
+ * @param deque the deque
+ * @param value pointer where the removed value should be put (or
+ * <tt>NULL</tt>)
+ *
+ * @return
+ * 0 if an element was removed\n
+ * 1 if the deque was empty\n
+ * 2 if the element was removed by another thread (the steal may be retried)
+ */
+int wsdequeSteal(WSDeque deque,void** value);
+
+/**
+ * Returns the approximate size of a work-stealing deque.
+ *
+ * The size may be outdated as soon as it is returned, when the deque is being
+ * used by other threads.
+ *
+ * @param deque the deque
+ *
+ * @return
+ * the approximate size of the deque
+ */
+int wsdequeSize(WSDeque deque);
+
+#endif